@@ -38,6 +38,275 @@
 
 static ov2640_handle_t gs_handle;        /**< ov2640 handle */
 
+/**
+ * @brief image resolution table definition
+ * @note  the images are size-only, zmhh is masked to keep the zoom speed bits,
+ *        a known zmhh stays in the burst of zmow and zmoh
+ */
+static const ov2640_batch_entry_t gsc_ov2640_image_resolution_table[13][3] =
+{
+    {
+        {OV2640_BANK_DSP, 0x5A, 0xFF, 0x28},        /* 160 x 120, zmow */
+        {OV2640_BANK_DSP, 0x5B, 0xFF, 0x1E},        /* zmoh */
+        {OV2640_BANK_DSP, 0x5C, 0x0F, 0x00},        /* zmhh */
+    },
+    {
+        {OV2640_BANK_DSP, 0x5A, 0xFF, 0x2C},        /* 176 x 144, zmow */
+        {OV2640_BANK_DSP, 0x5B, 0xFF, 0x24},        /* zmoh */
+        {OV2640_BANK_DSP, 0x5C, 0x0F, 0x00},        /* zmhh */
+    },
+    {
+        {OV2640_BANK_DSP, 0x5A, 0xFF, 0x50},        /* 320 x 240, zmow */
+        {OV2640_BANK_DSP, 0x5B, 0xFF, 0x3C},        /* zmoh */
+        {OV2640_BANK_DSP, 0x5C, 0x0F, 0x00},        /* zmhh */
+    },
+    {
+        {OV2640_BANK_DSP, 0x5A, 0xFF, 0x64},        /* 400 x 240, zmow */
+        {OV2640_BANK_DSP, 0x5B, 0xFF, 0x3C},        /* zmoh */
+        {OV2640_BANK_DSP, 0x5C, 0x0F, 0x00},        /* zmhh */
+    },
+    {
+        {OV2640_BANK_DSP, 0x5A, 0xFF, 0x58},        /* 352 x 288, zmow */
+        {OV2640_BANK_DSP, 0x5B, 0xFF, 0x48},        /* zmoh */
+        {OV2640_BANK_DSP, 0x5C, 0x0F, 0x00},        /* zmhh */
+    },
+    {
+        {OV2640_BANK_DSP, 0x5A, 0xFF, 0xA0},        /* 640 x 480, zmow */
+        {OV2640_BANK_DSP, 0x5B, 0xFF, 0x78},        /* zmoh */
+        {OV2640_BANK_DSP, 0x5C, 0x0F, 0x00},        /* zmhh */
+    },
+    {
+        {OV2640_BANK_DSP, 0x5A, 0xFF, 0xC8},        /* 800 x 600, zmow */
+        {OV2640_BANK_DSP, 0x5B, 0xFF, 0x96},        /* zmoh */
+        {OV2640_BANK_DSP, 0x5C, 0x0F, 0x00},        /* zmhh */
+    },
+    {
+        {OV2640_BANK_DSP, 0x5A, 0xFF, 0x00},        /* 1024 x 768, zmow */
+        {OV2640_BANK_DSP, 0x5B, 0xFF, 0xC0},        /* zmoh */
+        {OV2640_BANK_DSP, 0x5C, 0x0F, 0x01},        /* zmhh */
+    },
+    {
+        {OV2640_BANK_DSP, 0x5A, 0xFF, 0x40},        /* 1280 x 800, zmow */
+        {OV2640_BANK_DSP, 0x5B, 0xFF, 0xC8},        /* zmoh */
+        {OV2640_BANK_DSP, 0x5C, 0x0F, 0x01},        /* zmhh */
+    },
+    {
+        {OV2640_BANK_DSP, 0x5A, 0xFF, 0x40},        /* 1280 x 960, zmow */
+        {OV2640_BANK_DSP, 0x5B, 0xFF, 0xF0},        /* zmoh */
+        {OV2640_BANK_DSP, 0x5C, 0x0F, 0x01},        /* zmhh */
+    },
+    {
+        {OV2640_BANK_DSP, 0x5A, 0xFF, 0x68},        /* 1440 x 900, zmow */
+        {OV2640_BANK_DSP, 0x5B, 0xFF, 0xE1},        /* zmoh */
+        {OV2640_BANK_DSP, 0x5C, 0x0F, 0x01},        /* zmhh */
+    },
+    {
+        {OV2640_BANK_DSP, 0x5A, 0xFF, 0x40},        /* 1280 x 1024, zmow */
+        {OV2640_BANK_DSP, 0x5B, 0xFF, 0x00},        /* zmoh */
+        {OV2640_BANK_DSP, 0x5C, 0x0F, 0x05},        /* zmhh */
+    },
+    {
+        {OV2640_BANK_DSP, 0x5A, 0xFF, 0x90},        /* 1600 x 1200, zmow */
+        {OV2640_BANK_DSP, 0x5B, 0xFF, 0x2C},        /* zmoh */
+        {OV2640_BANK_DSP, 0x5C, 0x0F, 0x05},        /* zmhh */
+    },
+};
+
+/**
+ * @brief basic boot image definition
+ * @note  the final register image of ov2640_basic_init after ov2640_init,
+ *        run "ov2640_table boot" in project/linux/tool after changing OV2640_BASIC_DEFAULT_*
+ */
+static const uint8_t gsc_ov2640_basic_boot_table[] = 
+{
+    0x10,                                                                            /* dsp bank */
+    0xC1,                                                                            /* 2 pairs */
+        0x2C, 0xFF,
+        0x2E, 0xDF,
+    0x11,                                                                            /* sensor bank */
+    0xC9,                                                                            /* 10 pairs */
+        0x03, 0x0F,
+        0x04, 0xD8,
+        0x06, 0x88,
+        0x07, 0xC0,
+        0x09, 0x02,
+        0x0C, 0x3C,
+        0x0E, 0x41,
+        0x11, 0x00,
+        0x13, 0xE5,
+        0x14, 0x48,
+    0x84, 0x16, 0x10, 0x11, 0x75, 0x01, 0x97,                                        /* run 5 */
+    0x86, 0x20, 0x80, 0x99, 0x1A, 0x00, 0x40, 0x38, 0x82,                            /* run 7 */
+    0xC1,                                                                            /* 2 pairs */
+        0x28, 0x30,
+        0x2C, 0x0C,
+    0x85, 0x32, 0x36, 0x78, 0xC0, 0xDA, 0x1A, 0x40,                                  /* run 6 */
+    0x85, 0x39, 0x92, 0x33, 0xFB, 0x32, 0x34, 0x00,                                  /* run 6 */
+    0xC7,                                                                            /* 8 pairs */
+        0x42, 0x03,
+        0x43, 0x11,
+        0x46, 0x00,
+        0x48, 0x00,
+        0x4A, 0x81,
+        0x4C, 0x00,
+        0x4F, 0xCA,
+        0x50, 0xA8,
+    0x82, 0x5A, 0x23, 0x00, 0x00,                                                    /* run 3 */
+    0x82, 0x61, 0x70, 0x80, 0x00,                                                    /* run 3 */
+    0x82, 0x6C, 0x00, 0x38, 0x00,                                                    /* run 3 */
+    0xC3,                                                                            /* 4 pairs */
+        0x70, 0x02,
+        0x71, 0x94,
+        0x73, 0xC1,
+        0x7C, 0x05,
+    0x10,                                                                            /* dsp bank */
+    0xCD,                                                                            /* 14 pairs */
+        0xF9, 0xC0,
+        0x41, 0x24,
+        0xE0, 0x14,
+        0x33, 0xA0,
+        0x42, 0x20,
+        0x43, 0x18,
+        0x4C, 0x00,
+        0x76, 0xFF,
+        0x87, 0xD5,
+        0x88, 0x3F,
+        0xC8, 0x08,
+        0xC9, 0x80,
+        0xD7, 0x03,
+        0xD9, 0x10,
+    0x41, 0x7C, 0x00,                                                                /* fill 2 */
+    0xD6,                                                                            /* 23 pairs */
+        0x7C, 0x03,
+        0x7D, 0x48,
+        0x7D, 0x48,
+        0x7C, 0x08,
+        0x7D, 0x20,
+        0x7D, 0x10,
+        0x7D, 0x0E,
+        0x90, 0x00,
+        0x91, 0x0E,
+        0x91, 0x1A,
+        0x91, 0x31,
+        0x91, 0x5A,
+        0x91, 0x69,
+        0x91, 0x75,
+        0x91, 0x7E,
+        0x91, 0x88,
+        0x91, 0x8F,
+        0x91, 0x96,
+        0x91, 0xA3,
+        0x91, 0xAF,
+        0x91, 0xC4,
+        0x91, 0xD7,
+        0x91, 0xE8,
+    0x82, 0x91, 0x20, 0x00, 0x06,                                                    /* run 3 */
+    0xD9,                                                                            /* 26 pairs */
+        0x93, 0xE3,
+        0x93, 0x05,
+        0x93, 0x05,
+        0x93, 0x00,
+        0x93, 0x04,
+        0x93, 0x00,
+        0x93, 0x00,
+        0x93, 0x00,
+        0x93, 0x00,
+        0x93, 0x00,
+        0x93, 0x00,
+        0x93, 0x00,
+        0x96, 0x00,
+        0x97, 0x08,
+        0x97, 0x19,
+        0x97, 0x02,
+        0x97, 0x0C,
+        0x97, 0x24,
+        0x97, 0x30,
+        0x97, 0x28,
+        0x97, 0x26,
+        0x97, 0x02,
+        0x97, 0x98,
+        0x97, 0x80,
+        0x97, 0x00,
+        0x97, 0x00,
+    0x85, 0x50, 0x00, 0x90, 0x2C, 0x00, 0x00, 0x88,                                  /* run 6 */
+    0x82, 0x5A, 0x90, 0x2C, 0x05,                                                    /* run 3 */
+    0xC4,                                                                            /* 5 pairs */
+        0x7F, 0x00,
+        0x86, 0x3D,
+        0x8C, 0x00,
+        0xA4, 0x00,
+        0xA8, 0x00,
+    0x89, 0xB0, 0xC5, 0x94, 0x0F, 0xAF, 0x97, 0xFF, 0x66, 0x64, 0xA5, 0x7C,          /* run 10 */
+    0x82, 0xBF, 0x80, 0xC8, 0x96,                                                    /* run 3 */
+    0x84, 0xC3, 0xED, 0x5C, 0x11, 0x51, 0x10,                                        /* run 5 */
+    0xC6,                                                                            /* 7 pairs */
+        0xD3, 0x02,
+        0xDA, 0x09,
+        0xE1, 0x67,
+        0xE5, 0x1F,
+        0xE0, 0x00,
+        0xDD, 0x7F,
+        0x05, 0x00,
+    0x11,                                                                            /* sensor bank */
+    0xC5,                                                                            /* 6 pairs */
+        0x00, 0x00,
+        0x08, 0x40,
+        0x0D, 0x83,
+        0x10, 0x33,
+        0x12, 0x00,
+        0x2B, 0x00,
+    0x42, 0x2D, 0x00,                                                                /* fill 3 */
+    0xC5,                                                                            /* 6 pairs */
+        0x30, 0x08,
+        0x31, 0x30,
+        0x45, 0x00,
+        0x47, 0x00,
+        0x49, 0x00,
+        0x4B, 0x20,
+    0x43, 0x5D, 0x00,                                                                /* fill 4 */
+    0x10,                                                                            /* dsp bank */
+    0xC5,                                                                            /* 6 pairs */
+        0x05, 0x01,
+        0x44, 0x0C,
+        0xC2, 0x0C,
+        0xF0, 0x04,
+        0xF8, 0x21,
+        0x05, 0x00,
+};
+
+/**
+ * @brief warm init key register definition
+ * @note  the clock, timing, window, output size and format registers, the gain and exposure registers change by themselves
+ */
+static const ov2640_key_register_t gsc_ov2640_basic_key_table[] =
+{
+    {OV2640_BANK_SENSOR, 0x04, 0xFF},        /* reg04, mirror and flip */
+    {OV2640_BANK_SENSOR, 0x11, 0xFF},        /* clkrc */
+    {OV2640_BANK_SENSOR, 0x12, 0x7F},        /* com7 without the software reset bit */
+    {OV2640_BANK_SENSOR, 0x13, 0xFF},        /* com8 */
+    {OV2640_BANK_SENSOR, 0x14, 0xFF},        /* com9 */
+    {OV2640_BANK_SENSOR, 0x17, 0xFF},        /* hrefst */
+    {OV2640_BANK_SENSOR, 0x18, 0xFF},        /* hrefend */
+    {OV2640_BANK_SENSOR, 0x19, 0xFF},        /* vstrt */
+    {OV2640_BANK_SENSOR, 0x1A, 0xFF},        /* vend */
+    {OV2640_BANK_DSP, 0x05, 0xFF},           /* r_bypass */
+    {OV2640_BANK_DSP, 0x44, 0xFF},           /* qs */
+    {OV2640_BANK_DSP, 0x50, 0xFF},           /* ctrli */
+    {OV2640_BANK_DSP, 0x51, 0xFF},           /* hsize */
+    {OV2640_BANK_DSP, 0x52, 0xFF},           /* vsize */
+    {OV2640_BANK_DSP, 0x5A, 0xFF},           /* zmow */
+    {OV2640_BANK_DSP, 0x5B, 0xFF},           /* zmoh */
+    {OV2640_BANK_DSP, 0x5C, 0xFF},           /* zmhh */
+    {OV2640_BANK_DSP, 0x86, 0xFF},           /* ctrl2 */
+    {OV2640_BANK_DSP, 0x87, 0xFF},           /* ctrl3 */
+    {OV2640_BANK_DSP, 0xC0, 0xFF},           /* hsize8 */
+    {OV2640_BANK_DSP, 0xC1, 0xFF},           /* vsize8 */
+    {OV2640_BANK_DSP, 0xC2, 0xFF},           /* ctrl0 */
+    {OV2640_BANK_DSP, 0xC3, 0xFF},           /* ctrl1 */
+    {OV2640_BANK_DSP, 0xD3, 0xFF},           /* r_dvp_sp */
+    {OV2640_BANK_DSP, 0xDA, 0xFF},           /* image_mode */
+};
+
 /**
  * @brief  basic example init
  * @return status code
@@ -63,6 +332,7 @@ uint8_t ov2640_basic_init(void)
     DRIVER_OV2640_LINK_RESET_WRITE(&gs_handle, ov2640_interface_reset_write);
     DRIVER_OV2640_LINK_DELAY_MS(&gs_handle, ov2640_interface_delay_ms);
     DRIVER_OV2640_LINK_DEBUG_PRINT(&gs_handle, ov2640_interface_debug_print);
+    DRIVER_OV2640_LINK_TIMESTAMP_US(&gs_handle, ov2640_interface_timestamp_us);
     
     /* ov2640 init */
     res = ov2640_init(&gs_handle);
@@ -73,6 +343,16 @@ uint8_t ov2640_basic_init(void)
         return 1;
     }
     
+    /* set burst write */
+    res = ov2640_set_burst_write(&gs_handle, OV2640_BASIC_DEFAULT_BURST_WRITE);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: set burst write failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
     /* table init */
     res = ov2640_table_init(&gs_handle);
     if (res != 0)
@@ -83,6 +363,16 @@ uint8_t ov2640_basic_init(void)
         return 1;
     }
     
+    /* begin the sensor transaction */
+    res = ov2640_transaction_begin(&gs_handle);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: transaction begin failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
     /* set default clock rate double */
     res = ov2640_set_clock_rate_double(&gs_handle, OV2640_BASIC_DEFAULT_CLOCK_RATE_DOUBLE);
     if (res != 0)
@@ -593,6 +883,16 @@ uint8_t ov2640_basic_init(void)
         return 1;
     }
     
+    /* commit the sensor transaction */
+    res = ov2640_transaction_commit(&gs_handle);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: transaction commit failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
     /* enable dsp bypass */
     res = ov2640_set_dsp_bypass(&gs_handle, OV2640_BOOL_TRUE);
     if (res != 0)
@@ -603,6 +903,16 @@ uint8_t ov2640_basic_init(void)
         return 1;
     }
     
+    /* begin the dsp transaction */
+    res = ov2640_transaction_begin(&gs_handle);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: transaction begin failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
     /* set default bpc */
     res = ov2640_set_bpc(&gs_handle, OV2640_BASIC_DEFAULT_DSP_BPC);
     if (res != 0)
@@ -1103,6 +1413,16 @@ uint8_t ov2640_basic_init(void)
         return 1;
     }
     
+    /* commit the dsp transaction */
+    res = ov2640_transaction_commit(&gs_handle);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: transaction commit failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
     /* disable dsp bypass */
     res = ov2640_set_dsp_bypass(&gs_handle, OV2640_BOOL_FALSE);
     if (res != 0)
@@ -1116,6 +1436,178 @@ uint8_t ov2640_basic_init(void)
     return 0;
 }
 
+/**
+ * @brief  basic example fast init
+ * @return status code
+ *         - 0 success
+ *         - 1 init failed
+ * @note   writes the precomputed register image of ov2640_basic_init in one ordered table,
+ *         ov2640_basic_init is kept to verify the image
+ */
+uint8_t ov2640_basic_fast_init(void)
+{
+    uint8_t res;
+    
+    /* link interface function */
+    DRIVER_OV2640_LINK_INIT(&gs_handle, ov2640_handle_t);
+    DRIVER_OV2640_LINK_SCCB_INIT(&gs_handle, ov2640_interface_sccb_init);
+    DRIVER_OV2640_LINK_SCCB_DEINIT(&gs_handle, ov2640_interface_sccb_deinit);
+    DRIVER_OV2640_LINK_SCCB_READ(&gs_handle, ov2640_interface_sccb_read);
+    DRIVER_OV2640_LINK_SCCB_WRITE(&gs_handle, ov2640_interface_sccb_write);
+    DRIVER_OV2640_LINK_POWER_DOWN_INIT(&gs_handle, ov2640_interface_power_down_init);
+    DRIVER_OV2640_LINK_POWER_DOWN_DEINIT(&gs_handle, ov2640_interface_power_down_deinit);
+    DRIVER_OV2640_LINK_POWER_DOWN_WRITE(&gs_handle, ov2640_interface_power_down_write);
+    DRIVER_OV2640_LINK_RESET_INIT(&gs_handle, ov2640_interface_reset_init);
+    DRIVER_OV2640_LINK_RESET_DEINIT(&gs_handle, ov2640_interface_reset_deinit);
+    DRIVER_OV2640_LINK_RESET_WRITE(&gs_handle, ov2640_interface_reset_write);
+    DRIVER_OV2640_LINK_DELAY_MS(&gs_handle, ov2640_interface_delay_ms);
+    DRIVER_OV2640_LINK_DEBUG_PRINT(&gs_handle, ov2640_interface_debug_print);
+    DRIVER_OV2640_LINK_TIMESTAMP_US(&gs_handle, ov2640_interface_timestamp_us);
+    
+    /* ov2640 init */
+    res = ov2640_init(&gs_handle);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: init failed.\n");
+        
+        return 1;
+    }
+    
+    /* set burst write */
+    res = ov2640_set_burst_write(&gs_handle, OV2640_BASIC_DEFAULT_BURST_WRITE);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: set burst write failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* write the boot image */
+    res = ov2640_write_table(&gs_handle, gsc_ov2640_basic_boot_table, sizeof(gsc_ov2640_basic_boot_table));
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: write table failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      basic example warm init
+ * @param[in]  checksum key register checksum saved by ov2640_basic_get_checksum
+ * @param[out] *warm pointer to a bool buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 init failed
+ * @note       keeps the sensor state when the key registers match the checksum,
+ *             otherwise runs ov2640_basic_fast_init and sets warm to false
+ */
+uint8_t ov2640_basic_warm_init(uint16_t checksum, ov2640_bool_t *warm)
+{
+    uint8_t res;
+    
+    /* link interface function */
+    DRIVER_OV2640_LINK_INIT(&gs_handle, ov2640_handle_t);
+    DRIVER_OV2640_LINK_SCCB_INIT(&gs_handle, ov2640_interface_sccb_init);
+    DRIVER_OV2640_LINK_SCCB_DEINIT(&gs_handle, ov2640_interface_sccb_deinit);
+    DRIVER_OV2640_LINK_SCCB_READ(&gs_handle, ov2640_interface_sccb_read);
+    DRIVER_OV2640_LINK_SCCB_WRITE(&gs_handle, ov2640_interface_sccb_write);
+    DRIVER_OV2640_LINK_POWER_DOWN_INIT(&gs_handle, ov2640_interface_power_down_init);
+    DRIVER_OV2640_LINK_POWER_DOWN_DEINIT(&gs_handle, ov2640_interface_power_down_deinit);
+    DRIVER_OV2640_LINK_POWER_DOWN_WRITE(&gs_handle, ov2640_interface_power_down_write);
+    DRIVER_OV2640_LINK_RESET_INIT(&gs_handle, ov2640_interface_reset_init);
+    DRIVER_OV2640_LINK_RESET_DEINIT(&gs_handle, ov2640_interface_reset_deinit);
+    DRIVER_OV2640_LINK_RESET_WRITE(&gs_handle, ov2640_interface_reset_write);
+    DRIVER_OV2640_LINK_DELAY_MS(&gs_handle, ov2640_interface_delay_ms);
+    DRIVER_OV2640_LINK_DEBUG_PRINT(&gs_handle, ov2640_interface_debug_print);
+    DRIVER_OV2640_LINK_TIMESTAMP_US(&gs_handle, ov2640_interface_timestamp_us);
+    
+    /* ov2640 warm init */
+    res = ov2640_warm_init(&gs_handle, gsc_ov2640_basic_key_table,
+                           sizeof(gsc_ov2640_basic_key_table) / sizeof(ov2640_key_register_t), checksum);
+    if (res != 0)
+    {
+        *warm = OV2640_BOOL_FALSE;
+        
+        /* the sensor state is lost */
+        return ov2640_basic_fast_init();
+    }
+    *warm = OV2640_BOOL_TRUE;
+    
+    /* set burst write */
+    res = ov2640_set_burst_write(&gs_handle, OV2640_BASIC_DEFAULT_BURST_WRITE);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: set burst write failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      basic example get checksum
+ * @param[out] *checksum pointer to a checksum buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get checksum failed
+ * @note       run after the last configuration and keep the checksum over the mcu restart
+ */
+uint8_t ov2640_basic_get_checksum(uint16_t *checksum)
+{
+    if (ov2640_get_register_checksum(&gs_handle, gsc_ov2640_basic_key_table,
+                                     sizeof(gsc_ov2640_basic_key_table) / sizeof(ov2640_key_register_t),
+                                     checksum) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      basic example get perf stats
+ * @param[in]  perf timed api or bus call
+ * @param[out] *stats pointer to an ov2640 perf stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get perf stats failed
+ * @note       none
+ */
+uint8_t ov2640_basic_get_perf_stats(ov2640_perf_t perf, ov2640_perf_stats_t *stats)
+{
+    if (ov2640_get_perf_stats(&gs_handle, perf, stats) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      basic example get bus stats
+ * @param[out] *stats pointer to an ov2640 bus stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get bus stats failed
+ * @note       the counters are never cleared, take the difference of two reads
+ */
+uint8_t ov2640_basic_get_bus_stats(ov2640_bus_stats_t *stats)
+{
+    if (ov2640_get_bus_stats(&gs_handle, stats) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
 /**
  * @brief  basic example deinit
  * @return status code
@@ -1139,12 +1631,12 @@ uint8_t ov2640_basic_deinit(void)
  * @return status code
  *         - 0 success
  *         - 1 set jpeg mode failed
- * @note   none
+ * @note   only the registers that differ from the current format are written
  */
 uint8_t ov2640_basic_set_jpeg_mode(void)
 {
     /* enter to jpeg mode */
-    if (ov2640_table_jpeg_init(&gs_handle) != 0)
+    if (ov2640_switch_output_format(&gs_handle, OV2640_OUTPUT_FORMAT_JPEG) != 0)
     {
         return 1;
     }
@@ -1157,12 +1649,12 @@ uint8_t ov2640_basic_set_jpeg_mode(void)
  * @return status code
  *         - 0 success
  *         - 1 set rgb565 mode failed
- * @note   none
+ * @note   only the registers that differ from the current format are written
  */
 uint8_t ov2640_basic_set_rgb565_mode(void)
 {
     /* enter to rgb565 mode */
-    if (ov2640_table_rgb565_init(&gs_handle) != 0)
+    if (ov2640_switch_output_format(&gs_handle, OV2640_OUTPUT_FORMAT_RGB565) != 0)
     {
         return 1;
     }
@@ -1271,229 +1763,23 @@ uint8_t ov2640_basic_set_special_effect(ov2640_special_effect_t effect)
  * @return    status code
  *            - 0 success
  *            - 1 set image resolution failed
- * @note      none
+ * @note      the register image of the resolution is written as one batch,
+ *            the image only holds the output size in zmow, zmoh and zmhh and keeps the zoom speed,
+ *            hsize, vsize, the dividers and the dsp reset are left as set by the init table
  */
 uint8_t ov2640_basic_set_image_resolution(ov2640_image_resolution_t resolution)
 {
-    uint8_t res;
+    /* check the resolution */
+    if (resolution > OV2640_IMAGE_RESOLUTION_UXGA)
+    {
+        return 1;
+    }
     
-    switch (resolution)
-    {
-        case OV2640_IMAGE_RESOLUTION_QQVGA:
-        {
-            /* 160 x 120 */
-            res = ov2640_set_output_width(&gs_handle, 160 / 4);
-            if (res != 0)
-            {
-                break;
-            }
-            res = ov2640_set_output_height(&gs_handle, 120 / 4);
-            if (res != 0)
-            {
-                break;
-            }
-            
-            break;
-        }
-        case OV2640_IMAGE_RESOLUTION_QCIF:
-        {
-            /* 176 x 144 */
-            res = ov2640_set_output_width(&gs_handle, 176 / 4);
-            if (res != 0)
-            {
-                break;
-            }
-            res = ov2640_set_output_height(&gs_handle, 144 / 4);
-            if (res != 0)
-            {
-                break;
-            }
-            
-            break;
-        }
-        case OV2640_IMAGE_RESOLUTION_QVGA:
-        {
-            /* 320 x 240 */
-            res = ov2640_set_output_width(&gs_handle, 320 / 4);
-            if (res != 0)
-            {
-                break;
-            }
-            res = ov2640_set_output_height(&gs_handle, 240 / 4);
-            if (res != 0)
-            {
-                break;
-            }
-            
-            break;
-        }
-        case OV2640_IMAGE_RESOLUTION_WQVGA:
-        {
-            /* 400 x 240 */
-            res = ov2640_set_output_width(&gs_handle, 400 / 4);
-            if (res != 0)
-            {
-                break;
-            }
-            res = ov2640_set_output_height(&gs_handle, 240 / 4);
-            if (res != 0)
-            {
-                break;
-            }
-            
-            break;
-        }
-        case OV2640_IMAGE_RESOLUTION_CIF:
-        {
-            /* 352 x 288 */
-            res = ov2640_set_output_width(&gs_handle, 352 / 4);
-            if (res != 0)
-            {
-                break;
-            }
-            res = ov2640_set_output_height(&gs_handle, 288 / 4);
-            if (res != 0)
-            {
-                break;
-            }
-            
-            break;
-        }
-        case OV2640_IMAGE_RESOLUTION_VGA:
-        {
-            /* 640 x 480 */
-            res = ov2640_set_output_width(&gs_handle, 640 / 4);
-            if (res != 0)
-            {
-                break;
-            }
-            res = ov2640_set_output_height(&gs_handle, 480 / 4);
-            if (res != 0)
-            {
-                break;
-            }
-            
-            break;
-        }
-        case OV2640_IMAGE_RESOLUTION_SVGA:
-        {
-            /* 800 x 600 */
-            res = ov2640_set_output_width(&gs_handle, 800 / 4);
-            if (res != 0)
-            {
-                break;
-            }
-            res = ov2640_set_output_height(&gs_handle, 600 / 4);
-            if (res != 0)
-            {
-                break;
-            }
-            
-            break;
-        }
-        case OV2640_IMAGE_RESOLUTION_XGA:
-        {
-            /* 1024 x 768 */
-            res = ov2640_set_output_width(&gs_handle, 1024 / 4);
-            if (res != 0)
-            {
-                break;
-            }
-            res = ov2640_set_output_height(&gs_handle, 768 / 4);
-            if (res != 0)
-            {
-                break;
-            }
-            
-            break;
-        }
-        case OV2640_IMAGE_RESOLUTION_WXGA:
-        {
-            /* 1280 x 800 */
-            res = ov2640_set_output_width(&gs_handle, 1280 / 4);
-            if (res != 0)
-            {
-                break;
-            }
-            res = ov2640_set_output_height(&gs_handle, 800 / 4);
-            if (res != 0)
-            {
-                break;
-            }
-            
-            break;
-        }
-        case OV2640_IMAGE_RESOLUTION_XVGA:
-        {
-            /* 1280 x 960 */
-            res = ov2640_set_output_width(&gs_handle, 1280 / 4);
-            if (res != 0)
-            {
-                break;
-            }
-            res = ov2640_set_output_height(&gs_handle, 960 / 4);
-            if (res != 0)
-            {
-                break;
-            }
-            
-            break;
-        }
-        case OV2640_IMAGE_RESOLUTION_WXGA_PLUS:
-        {
-            /* 1440 x 900 */
-            res = ov2640_set_output_width(&gs_handle, 1440 / 4);
-            if (res != 0)
-            {
-                break;
-            }
-            res = ov2640_set_output_height(&gs_handle, 900 / 4);
-            if (res != 0)
-            {
-                break;
-            }
-            
-            break;
-        }
-        case OV2640_IMAGE_RESOLUTION_SXGA:
-        {
-            /* 1280 x 1024 */
-            res = ov2640_set_output_width(&gs_handle, 1280 / 4);
-            if (res != 0)
-            {
-                break;
-            }
-            res = ov2640_set_output_height(&gs_handle, 1024 / 4);
-            if (res != 0)
-            {
-                break;
-            }
-            
-            break;
-        }
-        case OV2640_IMAGE_RESOLUTION_UXGA:
-        {
-            /* 1600 x 1200 */
-            res = ov2640_set_output_width(&gs_handle, 1600 / 4);
-            if (res != 0)
-            {
-                break;
-            }
-            res = ov2640_set_output_height(&gs_handle, 1200 / 4);
-            if (res != 0)
-            {
-                break;
-            }
-            
-            break;
-        }
-        default :
-        {
-            res = 1;
-            
-            break;
-        }
-    }
-    
-    return res;
+    /* write the image */
+    if (ov2640_write_batch(&gs_handle, gsc_ov2640_image_resolution_table[resolution], 3) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
 }
@@ -53,6 +53,7 @@ extern "C"{
 /**
  * @brief ov2640 basic example default definition
  */
+#define OV2640_BASIC_DEFAULT_BURST_WRITE                   OV2640_BOOL_TRUE                        /**< enable burst write */
 #define OV2640_BASIC_DEFAULT_CLOCK_RATE_DOUBLE             OV2640_BOOL_FALSE                       /**< disable double rate */
 #define OV2640_BASIC_DEFAULT_CLOCK_DIVIDER                 0x00                                    /**< div 0 */
 #define OV2640_BASIC_DEFAULT_MODE                          OV2640_MODE_NORMAL                      /**< normal mode */
@@ -140,7 +141,7 @@ extern "C"{
 #define OV2640_BASIC_DEFAULT_DSP_ZOOM_SPEED                0x00                                    /**< speed 0 */
 #define OV2640_BASIC_DEFAULT_DSP_QSF                       0x0C                                    /**< 0x0C */
 #define OV2640_BASIC_DEFAULT_DSP_SCCB_MASTER_SPEED         4                                       /**< 4 */
-#define OV2640_BASIC_DEFAULT_DSP_ADDRESS_AUTO_INC          OV2640_BOOL_FALSE                       /**< disable address auto inc */
+#define OV2640_BASIC_DEFAULT_DSP_ADDRESS_AUTO_INC          OV2640_BOOL_TRUE                        /**< enable address auto inc */
 #define OV2640_BASIC_DEFAULT_DSP_SCCB                      OV2640_BOOL_FALSE                       /**< disable sccb */
 #define OV2640_BASIC_DEFAULT_DSP_SCCB_CLOCK_DELAY          OV2640_BOOL_FALSE                       /**< disable sccb clock delay */
 #define OV2640_BASIC_DEFAULT_DSP_SCCB_ACCESS               OV2640_BOOL_FALSE                       /**< disable sccb access */
@@ -185,6 +186,59 @@ typedef enum
  */
 uint8_t ov2640_basic_init(void);
 
+/**
+ * @brief  basic example fast init
+ * @return status code
+ *         - 0 success
+ *         - 1 init failed
+ * @note   writes the precomputed register image of ov2640_basic_init in one ordered table,
+ *         ov2640_basic_init is kept to verify the image
+ */
+uint8_t ov2640_basic_fast_init(void);
+
+/**
+ * @brief      basic example warm init
+ * @param[in]  checksum key register checksum saved by ov2640_basic_get_checksum
+ * @param[out] *warm pointer to a bool buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 init failed
+ * @note       keeps the sensor state when the key registers match the checksum,
+ *             otherwise runs ov2640_basic_fast_init and sets warm to false
+ */
+uint8_t ov2640_basic_warm_init(uint16_t checksum, ov2640_bool_t *warm);
+
+/**
+ * @brief      basic example get checksum
+ * @param[out] *checksum pointer to a checksum buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get checksum failed
+ * @note       run after the last configuration and keep the checksum over the mcu restart
+ */
+uint8_t ov2640_basic_get_checksum(uint16_t *checksum);
+
+/**
+ * @brief      basic example get perf stats
+ * @param[in]  perf timed api or bus call
+ * @param[out] *stats pointer to an ov2640 perf stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get perf stats failed
+ * @note       none
+ */
+uint8_t ov2640_basic_get_perf_stats(ov2640_perf_t perf, ov2640_perf_stats_t *stats);
+
+/**
+ * @brief      basic example get bus stats
+ * @param[out] *stats pointer to an ov2640 bus stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get bus stats failed
+ * @note       the counters are never cleared, take the difference of two reads
+ */
+uint8_t ov2640_basic_get_bus_stats(ov2640_bus_stats_t *stats);
+
 /**
  * @brief  basic example deinit
  * @return status code
@@ -199,7 +253,7 @@ uint8_t ov2640_basic_deinit(void);
  * @return status code
  *         - 0 success
  *         - 1 set jpeg mode failed
- * @note   none
+ * @note   only the registers that differ from the current format are written
  */
 uint8_t ov2640_basic_set_jpeg_mode(void);
 
@@ -208,7 +262,7 @@ uint8_t ov2640_basic_set_jpeg_mode(void);
  * @return status code
  *         - 0 success
  *         - 1 set rgb565 mode failed
- * @note   none
+ * @note   only the registers that differ from the current format are written
  */
 uint8_t ov2640_basic_set_rgb565_mode(void);
 
@@ -268,7 +322,9 @@ uint8_t ov2640_basic_set_special_effect(ov2640_special_effect_t effect);
  * @return    status code
  *            - 0 success
  *            - 1 set image resolution failed
- * @note      none
+ * @note      the register image of the resolution is written as one batch,
+ *            the image only holds the output size in zmow, zmoh and zmhh and keeps the zoom speed,
+ *            hsize, vsize, the dividers and the dsp reset are left as set by the init table
  */
 uint8_t ov2640_basic_set_image_resolution(ov2640_image_resolution_t resolution);
 
@@ -94,6 +94,17 @@ uint8_t ov2640_interface_sccb_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint
  */
 uint8_t ov2640_interface_sccb_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
 
+/**
+ * @brief     interface sccb bus transfer
+ * @param[in] *seg pointer to an sccb segment buffer
+ * @param[in] count number of segments
+ * @return    status code
+ *            - 0 success
+ *            - 1 transfer failed
+ * @note      the segments must be sent in order, it is optional and only used when it is linked
+ */
+uint8_t ov2640_interface_sccb_transfer(ov2640_sccb_segment_t *seg, uint16_t count);
+
 /**
  * @brief  interface power down init
  * @return status code
@@ -157,6 +168,13 @@ uint8_t ov2640_interface_reset_write(uint8_t level);
  */
 void ov2640_interface_delay_ms(uint32_t ms);
 
+/**
+ * @brief  interface timestamp us
+ * @return free running time in us
+ * @note   it is optional and only used when it is linked, the value may wrap
+ */
+uint32_t ov2640_interface_timestamp_us(void);
+
 /**
  * @brief     interface print format data
  * @param[in] fmt format data
@@ -0,0 +1,222 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      linux_driver_ov2640_interface.c
+ * @brief     linux driver ov2640 interface source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-16
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/16  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ov2640_interface.h"
+#include "sim_bus.h"
+#include <stdarg.h>
+#include <stdio.h>
+
+/**
+ * @brief  interface sccb bus init
+ * @return status code
+ *         - 0 success
+ *         - 1 sccb init failed
+ * @note   none
+ */
+uint8_t ov2640_interface_sccb_init(void)
+{
+    return sim_bus_init();
+}
+
+/**
+ * @brief  interface sccb bus deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 sccb deinit failed
+ * @note   none
+ */
+uint8_t ov2640_interface_sccb_deinit(void)
+{
+    return sim_bus_deinit();
+}
+
+/**
+ * @brief      interface sccb bus read
+ * @param[in]  addr sccb device write address
+ * @param[in]  reg sccb register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t ov2640_interface_sccb_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    return sim_bus_read(addr, reg, buf, len);
+}
+
+/**
+ * @brief     interface sccb bus write
+ * @param[in] addr sccb device write address
+ * @param[in] reg sccb register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t ov2640_interface_sccb_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    return sim_bus_write(addr, reg, buf, len);
+}
+
+/**
+ * @brief     interface sccb bus transfer
+ * @param[in] *seg pointer to an sccb segment buffer
+ * @param[in] count number of segments
+ * @return    status code
+ *            - 0 success
+ *            - 1 transfer failed
+ * @note      the segments must be sent in order, it is optional and only used when it is linked
+ */
+uint8_t ov2640_interface_sccb_transfer(ov2640_sccb_segment_t *seg, uint16_t count)
+{
+    return sim_bus_transfer(seg, count);
+}
+
+/**
+ * @brief  interface power down init
+ * @return status code
+ *         - 0 success
+ *         - 1 power down init failed
+ * @note   none
+ */
+uint8_t ov2640_interface_power_down_init(void)
+{
+    return 0;
+}
+
+/**
+ * @brief  interface power down deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 power down deinit failed
+ * @note   none
+ */
+uint8_t ov2640_interface_power_down_deinit(void)
+{
+    return 0;
+}
+
+/**
+ * @brief     interface power down write
+ * @param[in] level set level
+ * @return    status code
+ *            - 0 success
+ *            - 1 power down write failed
+ * @note      the level is passed to the simulated chip
+ */
+uint8_t ov2640_interface_power_down_write(uint8_t level)
+{
+    sim_bus_set_power_down(level);
+    
+    return 0;
+}
+
+/**
+ * @brief  interface reset init
+ * @return status code
+ *         - 0 success
+ *         - 1 reset init failed
+ * @note   none
+ */
+uint8_t ov2640_interface_reset_init(void)
+{
+    return 0;
+}
+
+/**
+ * @brief  interface reset deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 reset deinit failed
+ * @note   none
+ */
+uint8_t ov2640_interface_reset_deinit(void)
+{
+    return 0;
+}
+
+/**
+ * @brief     interface reset write
+ * @param[in] level set level
+ * @return    status code
+ *            - 0 success
+ *            - 1 reset write failed
+ * @note      the level is passed to the simulated chip
+ */
+uint8_t ov2640_interface_reset_write(uint8_t level)
+{
+    sim_bus_set_reset(level);
+    
+    return 0;
+}
+
+/**
+ * @brief     interface delay ms
+ * @param[in] ms time
+ * @note      the simulated bus time is advanced instead of sleeping
+ */
+void ov2640_interface_delay_ms(uint32_t ms)
+{
+    sim_bus_wait(ms * 1000);
+}
+
+/**
+ * @brief  interface timestamp us
+ * @return free running time in us
+ * @note   the simulated bus time is returned
+ */
+uint32_t ov2640_interface_timestamp_us(void)
+{
+    return (uint32_t)sim_bus_get_time();
+}
+
+/**
+ * @brief     interface print format data
+ * @param[in] fmt format data
+ * @note      none
+ */
+void ov2640_interface_debug_print(const char *const fmt, ...)
+{
+    va_list args;
+    
+    va_start(args, fmt);
+    (void)vprintf((char const *)fmt, args);
+    va_end(args);
+}
@@ -0,0 +1,276 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      sim_bus.h
+ * @brief     simulated sccb bus header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-16
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/16  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef SIM_BUS_H
+#define SIM_BUS_H
+
+#include "driver_ov2640.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/**
+ * @defgroup sim_bus sim_bus function
+ * @brief    simulated sccb bus function modules
+ * @{
+ */
+
+/**
+ * @brief sim bus statistics structure definition
+ */
+typedef struct sim_bus_stats_s
+{
+    uint32_t call;             /**< bus function call count */
+    uint32_t read;             /**< read transaction count */
+    uint32_t write;            /**< write transaction count */
+    uint32_t bytes;            /**< data byte count */
+    uint32_t bank_switch;      /**< ra_dlmt write count */
+    uint32_t nack;             /**< injected nack count */
+    uint64_t time_us;          /**< simulated bus time in us */
+    uint64_t wait_us;          /**< delay time in us */
+} sim_bus_stats_t;
+
+/**
+ * @brief sim bus cost model structure definition
+ */
+typedef struct sim_bus_model_s
+{
+    uint32_t clock_hz;         /**< sccb clock */
+    uint32_t overhead_us;      /**< software overhead per transaction in us */
+} sim_bus_model_t;
+
+/**
+ * @brief sim bus write log function definition
+ */
+typedef void (*sim_bus_log_t)(uint8_t bank, uint8_t reg, uint8_t value);
+
+/**
+ * @brief  sim bus init
+ * @return status code
+ *         - 0 success
+ * @note   both register banks are reset to the power on state
+ */
+uint8_t sim_bus_init(void);
+
+/**
+ * @brief  sim bus deinit
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+uint8_t sim_bus_deinit(void);
+
+/**
+ * @brief     set the simulated sccb clock
+ * @param[in] hz clock frequency
+ * @note      default is 100000
+ */
+void sim_bus_set_clock(uint32_t hz);
+
+/**
+ * @brief     set the fault injection
+ * @param[in] period nack every period transactions
+ * @note      0 disables the fault injection, a nacked transaction has no effect
+ */
+void sim_bus_set_fault(uint32_t period);
+
+/**
+ * @brief     nack one transaction
+ * @param[in] n the n-th transaction from now is nacked once
+ * @note      0 cancels it, the nack position follows sim_bus_set_fault_late
+ */
+void sim_bus_set_fault_once(uint32_t n);
+
+/**
+ * @brief     set the nack position of the fault injection
+ * @param[in] late 1 nacks a write after its data bytes are written, 0 nacks it after the address phase
+ * @note      default is 0, a late nack leaves the written registers and the increased indirect addresses
+ */
+void sim_bus_set_fault_late(uint8_t late);
+
+/**
+ * @brief     set the write log
+ * @param[in] log pointer to a log function
+ * @note      NULL disables the log, every register write except ra_dlmt is logged with the selected bank,
+ *            the log is kept by sim_bus_init
+ */
+void sim_bus_set_log(sim_bus_log_t log);
+
+/**
+ * @brief     keep the registers over sim_bus_init
+ * @param[in] enable 1 keeps both register banks like a sensor that stays powered while the mcu restarts
+ * @note      default is 0
+ */
+void sim_bus_set_retain(uint8_t enable);
+
+/**
+ * @brief     set the soft reset time
+ * @param[in] us busy time after a com7 software reset
+ * @note      the chip nacks every transaction while it is busy, default is 0
+ */
+void sim_bus_set_reset_time(uint32_t us);
+
+/**
+ * @brief     set the power down pin
+ * @param[in] level pin level
+ * @note      the chip keeps the registers and nacks every transaction while the pin is high
+ */
+void sim_bus_set_power_down(uint8_t level);
+
+/**
+ * @brief     set the reset pin
+ * @param[in] level pin level
+ * @note      a low level resets all registers to the power on values, the chip nacks while the pin is low
+ */
+void sim_bus_set_reset(uint8_t level);
+
+/**
+ * @brief     set a stuck register
+ * @param[in] bank register bank
+ * @param[in] reg register address
+ * @param[in] mask bits that always read 0
+ * @note      0 disables the stuck bits, the write is acked and logged as usual
+ */
+void sim_bus_set_stuck(uint8_t bank, uint8_t reg, uint8_t mask);
+
+/**
+ * @brief      sim bus read
+ * @param[in]  addr device address
+ * @param[in]  reg register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len data length
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the register address increases when ss_ctrl bit5 is set
+ */
+uint8_t sim_bus_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief     sim bus write
+ * @param[in] addr device address
+ * @param[in] reg register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len data length
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      the register address increases when ss_ctrl bit5 is set
+ */
+uint8_t sim_bus_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief     sim bus transfer
+ * @param[in] *seg pointer to an sccb segment buffer
+ * @param[in] count number of segments
+ * @return    status code
+ *            - 0 success
+ *            - 1 transfer failed
+ * @note      all segments are run in one call, like a dma descriptor chain
+ */
+uint8_t sim_bus_transfer(ov2640_sccb_segment_t *seg, uint16_t count);
+
+/**
+ * @brief     advance the simulated time
+ * @param[in] us time in us
+ * @note      used by the simulated delay
+ */
+void sim_bus_wait(uint32_t us);
+
+/**
+ * @brief  get the simulated time
+ * @return time in us
+ * @note   the time of all bus transactions and delays since the program started
+ */
+uint64_t sim_bus_get_time(void);
+
+/**
+ * @brief      get the bus statistics
+ * @param[out] *stats pointer to a statistics structure
+ * @note       none
+ */
+void sim_bus_get_stats(sim_bus_stats_t *stats);
+
+/**
+ * @brief  clear the bus statistics
+ * @note   none
+ */
+void sim_bus_clear_stats(void);
+
+/**
+ * @brief     get the sccb phase count
+ * @param[in] *stats pointer to a statistics structure
+ * @return    phase count
+ * @note      a read is 3 phases and a write 2 phases before the data, a nack is 1 phase
+ */
+uint32_t sim_bus_phases(const sim_bus_stats_t *stats);
+
+/**
+ * @brief     estimate the time of the counted transactions
+ * @param[in] *stats pointer to a statistics structure
+ * @param[in] *model pointer to a cost model structure
+ * @return    estimated time in us
+ * @note      every phase is 9 clocks, the overhead is added per transaction and the delays as they are
+ */
+uint64_t sim_bus_estimate(const sim_bus_stats_t *stats, const sim_bus_model_t *model);
+
+/**
+ * @brief      peek a simulated register
+ * @param[in]  bank register bank
+ * @param[in]  reg register address
+ * @return     register value
+ * @note       no bus time is spent
+ */
+uint8_t sim_bus_peek(uint8_t bank, uint8_t reg);
+
+/**
+ * @brief     peek a simulated sde indirect register
+ * @param[in] addr sde address
+ * @return    register value
+ * @note      no bus time is spent
+ */
+uint8_t sim_bus_peek_sde(uint8_t addr);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
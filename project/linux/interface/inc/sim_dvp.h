@@ -0,0 +1,123 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      sim_dvp.h
+ * @brief     simulated dvp frame source header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-16
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/16  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef SIM_DVP_H
+#define SIM_DVP_H
+
+#include "sim_bus.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/**
+ * @defgroup sim_dvp sim_dvp function
+ * @brief    simulated dvp frame source function modules
+ * @{
+ */
+
+/**
+ * @brief sim dvp format enumeration definition
+ */
+typedef enum
+{
+    SIM_DVP_FORMAT_YUV422 = 0x00,        /**< yuv422, 2 bytes per pixel */
+    SIM_DVP_FORMAT_RAW10  = 0x01,        /**< raw10 bggr, one 10 bit sample in 2 bytes per pixel */
+    SIM_DVP_FORMAT_RGB565 = 0x02,        /**< rgb565, 2 bytes per pixel */
+    SIM_DVP_FORMAT_Y8     = 0x03,        /**< y8, 1 byte per pixel */
+    SIM_DVP_FORMAT_JPEG   = 0x04,        /**< jpeg stream */
+} sim_dvp_format_t;
+
+/**
+ * @brief sim dvp frame information structure definition
+ */
+typedef struct sim_dvp_info_s
+{
+    sim_dvp_format_t format;       /**< frame format */
+    uint16_t width;                /**< output width */
+    uint16_t height;               /**< output height */
+    uint8_t byte_swap;             /**< 1 low byte first */
+    uint8_t color_bar;             /**< 1 color bar test */
+    uint32_t pclk_hz;              /**< pixel clock */
+    uint32_t frame_size;           /**< max frame size in bytes */
+    uint32_t frame_us;             /**< frame period in us */
+} sim_dvp_info_t;
+
+/**
+ * @brief     set the input clock
+ * @param[in] hz xvclk frequency
+ * @note      default is 24000000
+ */
+void sim_dvp_set_xclk(uint32_t hz);
+
+/**
+ * @brief  reset the frame source
+ * @note   the frame count and the frame time restart from 0
+ */
+void sim_dvp_reset(void);
+
+/**
+ * @brief      get the frame information
+ * @param[out] *info pointer to a frame information structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 register state is invalid
+ * @note       the information is decoded from the simulated registers, so it follows the last driver writes
+ */
+uint8_t sim_dvp_get_info(sim_dvp_info_t *info);
+
+/**
+ * @brief      capture one frame
+ * @param[out] *buf pointer to a frame buffer
+ * @param[in]  size buffer size
+ * @param[out] *len pointer to a frame length buffer
+ * @param[out] *timestamp_us pointer to a frame end time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 capture failed
+ * @note       the frame time advances one frame period per capture at the modelled pixel clock
+ */
+uint8_t sim_dvp_capture(uint8_t *buf, uint32_t size, uint32_t *len, uint64_t *timestamp_us);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
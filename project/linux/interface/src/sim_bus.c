@@ -0,0 +1,640 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      sim_bus.c
+ * @brief     simulated sccb bus source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-16
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/16  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "sim_bus.h"
+#include <string.h>
+
+/**
+ * @brief sim bus register definition
+ */
+#define SIM_BUS_ADDRESS        0x60        /**< ov2640 sccb address */
+#define SIM_BUS_RA_DLMT        0xFF        /**< bank select register */
+#define SIM_BUS_SS_CTRL        0xF8        /**< dsp ss ctrl register */
+#define SIM_BUS_COM7           0x12        /**< sensor com7 register */
+#define SIM_BUS_BPADDR         0x7C        /**< dsp sde indirect address register */
+#define SIM_BUS_BPDATA         0x7D        /**< dsp sde indirect data register */
+
+static uint8_t gs_bank[2][256];            /**< dsp and sensor banks */
+static uint8_t gs_sde[256];                /**< sde indirect registers */
+static uint8_t gs_select;                  /**< selected bank */
+static uint32_t gs_clock = 100000;         /**< sccb clock */
+static sim_bus_stats_t gs_stats;           /**< bus statistics */
+static uint32_t gs_fault;                  /**< fault injection period */
+static uint8_t gs_fault_late;              /**< nack a write after its data */
+static uint32_t gs_fault_once;             /**< transactions left before a single nack */
+static uint32_t gs_count;                  /**< transaction count */
+static sim_bus_log_t gs_log;               /**< write log */
+static uint8_t gs_retain;                  /**< keep the registers over init */
+static uint64_t gs_now;                    /**< simulated time in us */
+static uint32_t gs_reset_time;             /**< soft reset busy time in us */
+static uint64_t gs_busy;                   /**< end of the busy time */
+static uint8_t gs_stuck_bank;              /**< stuck register bank */
+static uint8_t gs_stuck_reg;               /**< stuck register address */
+static uint8_t gs_stuck_mask;              /**< stuck bits */
+static uint8_t gs_power_down;              /**< power down pin level */
+static uint8_t gs_reset_pin = 1;           /**< reset pin level */
+
+/**
+ * @brief sim bus power on value table definition
+ * @note  a subset of the datasheet power on values, the other registers are 0
+ */
+static const uint8_t gsc_sim_bus_default[][3] =
+{
+    {1, 0x0A, 0x26},        /* pidh */
+    {1, 0x0B, 0x42},        /* pidl */
+    {1, 0x10, 0x33},        /* aec */
+    {1, 0x13, 0xC7},        /* com8 */
+    {1, 0x14, 0x50},        /* com9 */
+    {1, 0x17, 0x11},        /* hrefst */
+    {1, 0x18, 0x75},        /* hrefend */
+    {1, 0x19, 0x01},        /* vstrt */
+    {1, 0x1A, 0x97},        /* vend */
+    {1, 0x1C, 0x7F},        /* midh */
+    {1, 0x1D, 0xA2},        /* midl */
+    {1, 0x24, 0x78},        /* aew */
+    {1, 0x25, 0x68},        /* aeb */
+    {1, 0x26, 0xD4},        /* vv */
+    {0, 0xC3, 0xFF},        /* ctrl1 */
+    {0, 0xF7, 0x60},        /* ss_id */
+};
+
+/**
+ * @brief     spend bus time
+ * @param[in] phase sccb phase count
+ * @note      every phase is 9 clocks
+ */
+static void a_sim_bus_spend(uint32_t phase)
+{
+    uint64_t us;
+    
+    us = ((uint64_t)phase * 9 * 1000000 + gs_clock - 1) / gs_clock;
+    gs_stats.time_us += us;
+    gs_now += us;
+}
+
+/**
+ * @brief     reset a register bank
+ * @param[in] bank register bank
+ * @note      the bank is set to the power on values
+ */
+static void a_sim_bus_bank_reset(uint8_t bank)
+{
+    uint16_t i;
+    
+    memset(gs_bank[bank], 0, sizeof(gs_bank[bank]));
+    for (i = 0; i < sizeof(gsc_sim_bus_default) / 3; i++)
+    {
+        if (gsc_sim_bus_default[i][0] == bank)
+        {
+            gs_bank[bank][gsc_sim_bus_default[i][1]] = gsc_sim_bus_default[i][2];
+        }
+    }
+}
+
+/**
+ * @brief  reset the chip
+ * @note   both banks, the sde registers and the bank select are reset
+ */
+static void a_sim_bus_chip_reset(void)
+{
+    a_sim_bus_bank_reset(0);
+    a_sim_bus_bank_reset(1);
+    memset(gs_sde, 0, sizeof(gs_sde));
+    gs_select = 1;
+}
+
+/**
+ * @brief     check a read only register
+ * @param[in] bank register bank
+ * @param[in] reg register address
+ * @return    1 if the register is read only
+ * @note      none
+ */
+static uint8_t a_sim_bus_read_only(uint8_t bank, uint8_t reg)
+{
+    if ((bank == 1) && ((reg == 0x0A) || (reg == 0x0B) || (reg == 0x1C) || (reg == 0x1D)))
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  sim bus init
+ * @return status code
+ *         - 0 success
+ * @note   both register banks are reset to the power on state
+ */
+uint8_t sim_bus_init(void)
+{
+    if (gs_retain == 0)
+    {
+        a_sim_bus_chip_reset();
+    }
+    gs_count = 0;
+    memset(&gs_stats, 0, sizeof(gs_stats));
+    
+    return 0;
+}
+
+/**
+ * @brief  sim bus deinit
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+uint8_t sim_bus_deinit(void)
+{
+    return 0;
+}
+
+/**
+ * @brief     set the simulated sccb clock
+ * @param[in] hz clock frequency
+ * @note      default is 100000
+ */
+void sim_bus_set_clock(uint32_t hz)
+{
+    if (hz != 0)
+    {
+        gs_clock = hz;
+    }
+}
+
+/**
+ * @brief  fault check
+ * @return status code
+ *         - 0 ack
+ *         - 1 nack
+ * @note   a nack stops the transaction after the address phase, a busy chip nacks every transaction,
+ *         so does a chip in power down or with the reset pin low
+ */
+static uint8_t a_sim_bus_fault(void)
+{
+    uint8_t once;
+    
+    gs_count++;
+    once = 0;
+    if (gs_fault_once != 0)
+    {
+        gs_fault_once--;
+        once = (gs_fault_once == 0) ? 1 : 0;
+    }
+    if (((gs_fault != 0) && ((gs_count % gs_fault) == 0)) || (once != 0) || (gs_now < gs_busy) ||
+        (gs_power_down != 0) || (gs_reset_pin == 0))
+    {
+        gs_stats.nack++;
+        a_sim_bus_spend(1);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      bus read
+ * @param[in]  addr device address
+ * @param[in]  reg register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len data length
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+static uint8_t a_sim_bus_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    uint8_t inc;
+    uint8_t r;
+    uint16_t i;
+    
+    if (addr != SIM_BUS_ADDRESS)
+    {
+        return 1;
+    }
+    if (a_sim_bus_fault() != 0)
+    {
+        return 1;
+    }
+    
+    inc = (gs_bank[0][SIM_BUS_SS_CTRL] >> 5) & 0x01;
+    for (i = 0; i < len; i++)
+    {
+        r = (uint8_t)(reg + (inc != 0 ? i : 0));
+        if (r == SIM_BUS_RA_DLMT)
+        {
+            buf[i] = gs_select;
+        }
+        else if ((gs_select == 0) && (r == SIM_BUS_BPDATA))
+        {
+            buf[i] = gs_sde[gs_bank[0][SIM_BUS_BPADDR]];
+            gs_bank[0][SIM_BUS_BPADDR]++;
+        }
+        else if ((gs_select == 0) && ((r == 0x91) || (r == 0x93) || (r == 0x97)))
+        {
+            buf[i] = gs_bank[0][r];
+            gs_bank[0][r - 1]++;
+        }
+        else
+        {
+            buf[i] = gs_bank[gs_select][r];
+        }
+    }
+    gs_stats.read++;
+    gs_stats.bytes += len;
+    a_sim_bus_spend(2 + 1 + len);
+    
+    return 0;
+}
+
+/**
+ * @brief     bus write
+ * @param[in] addr device address
+ * @param[in] reg register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len data length
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+static uint8_t a_sim_bus_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    uint8_t inc;
+    uint8_t r;
+    uint8_t late;
+    uint16_t i;
+    
+    if (addr != SIM_BUS_ADDRESS)
+    {
+        return 1;
+    }
+    late = 0;
+    if (a_sim_bus_fault() != 0)
+    {
+        if ((gs_fault_late == 0) || (gs_now < gs_busy) || (gs_power_down != 0) || (gs_reset_pin == 0))
+        {
+            return 1;
+        }
+        late = 1;
+    }
+    
+    inc = (gs_bank[0][SIM_BUS_SS_CTRL] >> 5) & 0x01;
+    for (i = 0; i < len; i++)
+    {
+        r = (uint8_t)(reg + (inc != 0 ? i : 0));
+        if (r == SIM_BUS_RA_DLMT)
+        {
+            gs_select = buf[i] & 0x01;
+            gs_stats.bank_switch++;
+            
+            continue;
+        }
+        if (gs_log != NULL)
+        {
+            gs_log(gs_select, r, buf[i]);
+        }
+        if (a_sim_bus_read_only(gs_select, r) != 0)
+        {
+            continue;
+        }
+        if ((gs_select == 1) && (r == SIM_BUS_COM7) && ((buf[i] & 0x80) != 0))
+        {
+            a_sim_bus_bank_reset(1);
+            gs_busy = gs_now + gs_reset_time;
+            
+            continue;
+        }
+        if ((gs_select == 0) && (r == SIM_BUS_BPDATA))
+        {
+            gs_sde[gs_bank[0][SIM_BUS_BPADDR]] = buf[i];
+            gs_bank[0][SIM_BUS_BPADDR]++;
+        }
+        else if ((gs_select == 0) && ((r == 0x91) || (r == 0x93) || (r == 0x97)))
+        {
+            gs_bank[0][r - 1]++;
+        }
+        gs_bank[gs_select][r] = buf[i];
+        if ((gs_stuck_mask != 0) && (gs_select == gs_stuck_bank) && (r == gs_stuck_reg))
+        {
+            gs_bank[gs_select][r] &= (uint8_t)(~gs_stuck_mask);
+        }
+        if (gs_select == 0)
+        {
+            inc = (gs_bank[0][SIM_BUS_SS_CTRL] >> 5) & 0x01;
+        }
+    }
+    if (late != 0)
+    {
+        a_sim_bus_spend(1 + len);
+        
+        return 1;
+    }
+    gs_stats.write++;
+    gs_stats.bytes += len;
+    a_sim_bus_spend(2 + len);
+    
+    return 0;
+}
+
+/**
+ * @brief     set the fault injection
+ * @param[in] period nack every period transactions
+ * @note      0 disables the fault injection, a nacked transaction has no effect
+ */
+void sim_bus_set_fault(uint32_t period)
+{
+    gs_fault = period;
+    gs_count = 0;
+}
+
+/**
+ * @brief     nack one transaction
+ * @param[in] n the n-th transaction from now is nacked once
+ * @note      0 cancels it, the nack position follows sim_bus_set_fault_late
+ */
+void sim_bus_set_fault_once(uint32_t n)
+{
+    gs_fault_once = n;
+}
+
+/**
+ * @brief     set the nack position of the fault injection
+ * @param[in] late 1 nacks a write after its data bytes are written, 0 nacks it after the address phase
+ * @note      default is 0, a late nack leaves the written registers and the increased indirect addresses
+ */
+void sim_bus_set_fault_late(uint8_t late)
+{
+    gs_fault_late = late;
+}
+
+/**
+ * @brief     set the write log
+ * @param[in] log pointer to a log function
+ * @note      NULL disables the log, every register write except ra_dlmt is logged with the selected bank,
+ *            the log is kept by sim_bus_init
+ */
+void sim_bus_set_log(sim_bus_log_t log)
+{
+    gs_log = log;
+}
+
+/**
+ * @brief     keep the registers over sim_bus_init
+ * @param[in] enable 1 keeps both register banks like a sensor that stays powered while the mcu restarts
+ * @note      default is 0
+ */
+void sim_bus_set_retain(uint8_t enable)
+{
+    gs_retain = enable;
+}
+
+/**
+ * @brief     set the soft reset time
+ * @param[in] us busy time after a com7 software reset
+ * @note      the chip nacks every transaction while it is busy, default is 0
+ */
+void sim_bus_set_reset_time(uint32_t us)
+{
+    gs_reset_time = us;
+}
+
+/**
+ * @brief     set the power down pin
+ * @param[in] level pin level
+ * @note      the chip keeps the registers and nacks every transaction while the pin is high
+ */
+void sim_bus_set_power_down(uint8_t level)
+{
+    gs_power_down = level;
+}
+
+/**
+ * @brief     set the reset pin
+ * @param[in] level pin level
+ * @note      a low level resets all registers to the power on values, the chip nacks while the pin is low
+ */
+void sim_bus_set_reset(uint8_t level)
+{
+    if (level == 0)
+    {
+        a_sim_bus_chip_reset();
+    }
+    gs_reset_pin = level;
+}
+
+/**
+ * @brief     set a stuck register
+ * @param[in] bank register bank
+ * @param[in] reg register address
+ * @param[in] mask bits that always read 0
+ * @note      0 disables the stuck bits, the write is acked and logged as usual
+ */
+void sim_bus_set_stuck(uint8_t bank, uint8_t reg, uint8_t mask)
+{
+    gs_stuck_bank = bank;
+    gs_stuck_reg = reg;
+    gs_stuck_mask = mask;
+}
+
+/**
+ * @brief      sim bus read
+ * @param[in]  addr device address
+ * @param[in]  reg register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len data length
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the register address increases when ss_ctrl bit5 is set
+ */
+uint8_t sim_bus_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    gs_stats.call++;
+    
+    return a_sim_bus_read(addr, reg, buf, len);
+}
+
+/**
+ * @brief     sim bus write
+ * @param[in] addr device address
+ * @param[in] reg register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len data length
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      the register address increases when ss_ctrl bit5 is set
+ */
+uint8_t sim_bus_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    gs_stats.call++;
+    
+    return a_sim_bus_write(addr, reg, buf, len);
+}
+
+/**
+ * @brief     sim bus transfer
+ * @param[in] *seg pointer to an sccb segment buffer
+ * @param[in] count number of segments
+ * @return    status code
+ *            - 0 success
+ *            - 1 transfer failed
+ * @note      all segments are run in one call, like a dma descriptor chain
+ */
+uint8_t sim_bus_transfer(ov2640_sccb_segment_t *seg, uint16_t count)
+{
+    uint8_t res;
+    uint16_t i;
+    
+    gs_stats.call++;
+    for (i = 0; i < count; i++)
+    {
+        if (seg[i].dir == OV2640_SCCB_DIR_WRITE)
+        {
+            res = a_sim_bus_write(seg[i].addr, seg[i].reg, seg[i].buf, seg[i].len);
+        }
+        else
+        {
+            res = a_sim_bus_read(seg[i].addr, seg[i].reg, seg[i].buf, seg[i].len);
+        }
+        if (res != 0)
+        {
+            return 1;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     advance the simulated time
+ * @param[in] us time in us
+ * @note      used by the simulated delay
+ */
+void sim_bus_wait(uint32_t us)
+{
+    gs_stats.wait_us += us;
+    gs_stats.time_us += us;
+    gs_now += us;
+}
+
+/**
+ * @brief  get the simulated time
+ * @return time in us
+ * @note   the time of all bus transactions and delays since the program started
+ */
+uint64_t sim_bus_get_time(void)
+{
+    return gs_now;
+}
+
+/**
+ * @brief      get the bus statistics
+ * @param[out] *stats pointer to a statistics structure
+ * @note       none
+ */
+void sim_bus_get_stats(sim_bus_stats_t *stats)
+{
+    *stats = gs_stats;
+}
+
+/**
+ * @brief  clear the bus statistics
+ * @note   none
+ */
+void sim_bus_clear_stats(void)
+{
+    memset(&gs_stats, 0, sizeof(gs_stats));
+}
+
+/**
+ * @brief     get the sccb phase count
+ * @param[in] *stats pointer to a statistics structure
+ * @return    phase count
+ * @note      a read is 3 phases and a write 2 phases before the data, a nack is 1 phase
+ */
+uint32_t sim_bus_phases(const sim_bus_stats_t *stats)
+{
+    return 3 * stats->read + 2 * stats->write + stats->bytes + stats->nack;
+}
+
+/**
+ * @brief     estimate the time of the counted transactions
+ * @param[in] *stats pointer to a statistics structure
+ * @param[in] *model pointer to a cost model structure
+ * @return    estimated time in us
+ * @note      every phase is 9 clocks, the overhead is added per transaction and the delays as they are
+ */
+uint64_t sim_bus_estimate(const sim_bus_stats_t *stats, const sim_bus_model_t *model)
+{
+    uint64_t us;
+    
+    us = ((uint64_t)sim_bus_phases(stats) * 9 * 1000000 + model->clock_hz - 1) / model->clock_hz;
+    us += (uint64_t)model->overhead_us * (stats->read + stats->write + stats->nack);
+    
+    return us + stats->wait_us;
+}
+
+/**
+ * @brief      peek a simulated register
+ * @param[in]  bank register bank
+ * @param[in]  reg register address
+ * @return     register value
+ * @note       no bus time is spent
+ */
+uint8_t sim_bus_peek(uint8_t bank, uint8_t reg)
+{
+    if (reg == SIM_BUS_RA_DLMT)
+    {
+        return gs_select;
+    }
+    
+    return gs_bank[bank & 0x01][reg];
+}
+
+/**
+ * @brief     peek a simulated sde indirect register
+ * @param[in] addr sde address
+ * @return    register value
+ * @note      no bus time is spent
+ */
+uint8_t sim_bus_peek_sde(uint8_t addr)
+{
+    return gs_sde[addr];
+}
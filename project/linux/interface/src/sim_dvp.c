@@ -0,0 +1,386 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      sim_dvp.c
+ * @brief     simulated dvp frame source source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-16
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/16  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "sim_dvp.h"
+#include <string.h>
+
+/**
+ * @brief sim dvp register definition
+ */
+#define SIM_DVP_QS             0x44        /**< dsp quantization scale register */
+#define SIM_DVP_ZMOW           0x5A        /**< dsp output width register */
+#define SIM_DVP_ZMOH           0x5B        /**< dsp output height register */
+#define SIM_DVP_ZMHH           0x5C        /**< dsp output size high register */
+#define SIM_DVP_R_DVP_SP       0xD3        /**< dsp dvp pclk divider register */
+#define SIM_DVP_IMAGE_MODE     0xDA        /**< dsp image mode register */
+#define SIM_DVP_CLKRC          0x11        /**< sensor clock register */
+#define SIM_DVP_COM7           0x12        /**< sensor com7 register */
+#define SIM_DVP_REG32          0x32        /**< sensor pclk divider register */
+
+/**
+ * @brief sim dvp timing definition
+ */
+#define SIM_DVP_HBLANK         256         /**< horizontal blanking in pclk */
+#define SIM_DVP_VBLANK         40          /**< vertical blanking in lines */
+#define SIM_DVP_JPEG_HEADER    38          /**< soi, app0 and sof0 length */
+
+static uint32_t gs_xclk = 24000000;        /**< xvclk frequency */
+static uint32_t gs_frame;                  /**< frame count */
+static uint64_t gs_time;                   /**< frame time in us */
+
+/**
+ * @brief sim dvp color bar table definition
+ * @note  white, yellow, cyan, green, magenta, red, blue and black
+ */
+static const uint8_t gsc_sim_dvp_bar[8][3] =
+{
+    {0xFF, 0xFF, 0xFF},
+    {0xFF, 0xFF, 0x00},
+    {0x00, 0xFF, 0xFF},
+    {0x00, 0xFF, 0x00},
+    {0xFF, 0x00, 0xFF},
+    {0xFF, 0x00, 0x00},
+    {0x00, 0x00, 0xFF},
+    {0x00, 0x00, 0x00},
+};
+
+/**
+ * @brief      get the pixel color
+ * @param[in]  *info pointer to a frame information structure
+ * @param[in]  x column
+ * @param[in]  y row
+ * @param[out] *rgb pointer to a color buffer
+ * @note       the color bar test draws 8 vertical bars, otherwise a gradient moves one step per frame
+ */
+static void a_sim_dvp_pixel(const sim_dvp_info_t *info, uint32_t x, uint32_t y, uint8_t rgb[3])
+{
+    if (info->color_bar != 0)
+    {
+        memcpy(rgb, gsc_sim_dvp_bar[x * 8 / info->width], 3);
+        
+        return;
+    }
+    rgb[0] = (uint8_t)(x * 255 / info->width);
+    rgb[1] = (uint8_t)(y * 255 / info->height);
+    rgb[2] = (uint8_t)((x + y + gs_frame * 8) & 0xFF);
+}
+
+/**
+ * @brief     convert a color to luma
+ * @param[in] *rgb pointer to a color
+ * @return    y
+ * @note      bt.601 full range
+ */
+static uint8_t a_sim_dvp_y(const uint8_t rgb[3])
+{
+    return (uint8_t)((77 * rgb[0] + 150 * rgb[1] + 29 * rgb[2]) >> 8);
+}
+
+/**
+ * @brief     convert a color to blue chroma
+ * @param[in] *rgb pointer to a color
+ * @return    u
+ * @note      bt.601 full range
+ */
+static uint8_t a_sim_dvp_u(const uint8_t rgb[3])
+{
+    return (uint8_t)((-43 * rgb[0] - 85 * rgb[1] + 128 * rgb[2] + 32768) >> 8);
+}
+
+/**
+ * @brief     convert a color to red chroma
+ * @param[in] *rgb pointer to a color
+ * @return    v
+ * @note      bt.601 full range
+ */
+static uint8_t a_sim_dvp_v(const uint8_t rgb[3])
+{
+    return (uint8_t)((128 * rgb[0] - 107 * rgb[1] - 21 * rgb[2] + 32768) >> 8);
+}
+
+/**
+ * @brief     get the jpeg length
+ * @param[in] *info pointer to a frame information structure
+ * @param[in] frame frame count
+ * @return    frame length
+ * @note      the scan shrinks with the quantization scale and changes a little from frame to frame
+ */
+static uint32_t a_sim_dvp_jpeg_len(const sim_dvp_info_t *info, uint32_t frame)
+{
+    uint32_t qs;
+    
+    qs = sim_bus_peek(OV2640_BANK_DSP, SIM_DVP_QS);
+    
+    return SIM_DVP_JPEG_HEADER + (uint32_t)info->width * info->height * 2 / (8 + qs) + (frame % 8) * 64 + 2;
+}
+
+/**
+ * @brief     set the input clock
+ * @param[in] hz xvclk frequency
+ * @note      default is 24000000
+ */
+void sim_dvp_set_xclk(uint32_t hz)
+{
+    gs_xclk = hz;
+}
+
+/**
+ * @brief  reset the frame source
+ * @note   the frame count and the frame time restart from 0
+ */
+void sim_dvp_reset(void)
+{
+    gs_frame = 0;
+    gs_time = 0;
+}
+
+/**
+ * @brief      get the frame information
+ * @param[out] *info pointer to a frame information structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 register state is invalid
+ * @note       the system clock is xvclk * (clkrc bit7 ? 2 : 1) / (2 * (clkrc[5:0] + 1)) / (1 << reg32[7:6]) (3 is 2),
+ *             the pixel clock is the system clock divided by r_dvp_sp[6:0] (0 is 1),
+ *             yuv422, rgb565 and jpeg take 2 pclk per pixel, raw10 and y8 take 1 pclk per pixel
+ */
+uint8_t sim_dvp_get_info(sim_dvp_info_t *info)
+{
+    uint8_t mode;
+    uint8_t zmhh;
+    uint8_t clkrc;
+    uint8_t reg32;
+    uint8_t div;
+    uint32_t sysclk;
+    uint32_t pclk_per_pixel;
+    uint64_t pclk;
+    
+    mode = sim_bus_peek(OV2640_BANK_DSP, SIM_DVP_IMAGE_MODE);
+    zmhh = sim_bus_peek(OV2640_BANK_DSP, SIM_DVP_ZMHH);
+    info->width = (uint16_t)((((zmhh >> 0) & 0x03) << 8) | sim_bus_peek(OV2640_BANK_DSP, SIM_DVP_ZMOW)) * 4;
+    info->height = (uint16_t)((((zmhh >> 2) & 0x01) << 8) | sim_bus_peek(OV2640_BANK_DSP, SIM_DVP_ZMOH)) * 4;
+    info->byte_swap = (mode >> 0) & 0x01;
+    info->color_bar = (sim_bus_peek(OV2640_BANK_SENSOR, SIM_DVP_COM7) >> 1) & 0x01;
+    if (((mode >> 4) & 0x01) != 0)
+    {
+        info->format = SIM_DVP_FORMAT_JPEG;
+    }
+    else if (((mode >> 6) & 0x01) != 0)
+    {
+        info->format = SIM_DVP_FORMAT_Y8;
+    }
+    else if (((mode >> 2) & 0x03) != 0x03)
+    {
+        info->format = (sim_dvp_format_t)((mode >> 2) & 0x03);
+    }
+    else
+    {
+        return 1;
+    }
+    if ((info->width == 0) || (info->height == 0))
+    {
+        return 1;
+    }
+    
+    clkrc = sim_bus_peek(OV2640_BANK_SENSOR, SIM_DVP_CLKRC);
+    reg32 = (sim_bus_peek(OV2640_BANK_SENSOR, SIM_DVP_REG32) >> 6) & 0x03;
+    div = sim_bus_peek(OV2640_BANK_DSP, SIM_DVP_R_DVP_SP) & 0x7F;
+    sysclk = gs_xclk * (((clkrc >> 7) & 0x01) + 1) / (2 * ((clkrc & 0x3F) + 1));
+    sysclk >>= (reg32 == 0x03) ? 0x02 : reg32;
+    info->pclk_hz = sysclk / ((div != 0) ? div : 1);
+    if (info->pclk_hz == 0)
+    {
+        return 1;
+    }
+    pclk_per_pixel = ((info->format == SIM_DVP_FORMAT_RAW10) || (info->format == SIM_DVP_FORMAT_Y8)) ? 1 : 2;
+    pclk = ((uint64_t)info->width * pclk_per_pixel + SIM_DVP_HBLANK) * (info->height + SIM_DVP_VBLANK);
+    info->frame_us = (uint32_t)((pclk * 1000000 + info->pclk_hz - 1) / info->pclk_hz);
+    if (info->format == SIM_DVP_FORMAT_JPEG)
+    {
+        info->frame_size = a_sim_dvp_jpeg_len(info, 7);
+    }
+    else
+    {
+        info->frame_size = (uint32_t)info->width * info->height * ((info->format == SIM_DVP_FORMAT_Y8) ? 1 : 2);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      write the jpeg frame
+ * @param[in]  *info pointer to a frame information structure
+ * @param[out] *buf pointer to a frame buffer
+ * @param[in]  len frame length
+ * @note       soi, a jfif app0, a baseline sof0 with the output size, a scan without 0xFF bytes and eoi,
+ *             enough for the capture code to find the markers and the size
+ */
+static void a_sim_dvp_jpeg(const sim_dvp_info_t *info, uint8_t *buf, uint32_t len)
+{
+    static const uint8_t app0[20] = {0xFF, 0xD8, 0xFF, 0xE0, 0x00, 0x10, 'J', 'F', 'I', 'F', 0x00,
+                                     0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00};
+    uint32_t i;
+    uint32_t seed;
+    
+    memcpy(buf, app0, sizeof(app0));
+    buf[20] = 0xFF;
+    buf[21] = 0xC0;
+    buf[22] = 0x00;
+    buf[23] = 0x11;
+    buf[24] = 0x08;
+    buf[25] = (uint8_t)(info->height >> 8);
+    buf[26] = (uint8_t)(info->height & 0xFF);
+    buf[27] = (uint8_t)(info->width >> 8);
+    buf[28] = (uint8_t)(info->width & 0xFF);
+    buf[29] = 0x03;
+    buf[30] = 0x01;
+    buf[31] = 0x21;
+    buf[32] = 0x00;
+    buf[33] = 0x02;
+    buf[34] = 0x11;
+    buf[35] = 0x01;
+    buf[36] = 0x03;
+    buf[37] = 0x11;
+    seed = gs_frame * 2654435761U + 1;
+    for (i = SIM_DVP_JPEG_HEADER; i < len - 2; i++)
+    {
+        seed = seed * 1103515245 + 12345;
+        buf[i] = (uint8_t)((seed >> 16) % 0xFF);
+    }
+    buf[len - 2] = 0xFF;
+    buf[len - 1] = 0xD9;
+}
+
+/**
+ * @brief      capture one frame
+ * @param[out] *buf pointer to a frame buffer
+ * @param[in]  size buffer size
+ * @param[out] *len pointer to a frame length buffer
+ * @param[out] *timestamp_us pointer to a frame end time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 capture failed
+ * @note       the frame time advances one frame period per capture at the modelled pixel clock
+ */
+uint8_t sim_dvp_capture(uint8_t *buf, uint32_t size, uint32_t *len, uint64_t *timestamp_us)
+{
+    sim_dvp_info_t info;
+    uint8_t rgb[2][3];
+    uint8_t hi;
+    uint8_t lo;
+    uint16_t c;
+    uint32_t x;
+    uint32_t y;
+    uint8_t *p;
+    
+    if (sim_dvp_get_info(&info) != 0)
+    {
+        return 1;
+    }
+    *len = (info.format == SIM_DVP_FORMAT_JPEG) ? a_sim_dvp_jpeg_len(&info, gs_frame) : info.frame_size;
+    if (*len > size)
+    {
+        return 1;
+    }
+    
+    p = buf;
+    if (info.format == SIM_DVP_FORMAT_JPEG)
+    {
+        a_sim_dvp_jpeg(&info, buf, *len);
+    }
+    else
+    {
+        for (y = 0; y < info.height; y++)
+        {
+            for (x = 0; x < info.width; x += 2)
+            {
+                a_sim_dvp_pixel(&info, x, y, rgb[0]);
+                a_sim_dvp_pixel(&info, x + 1, y, rgb[1]);
+                if (info.format == SIM_DVP_FORMAT_RGB565)
+                {
+                    c = (uint16_t)(((rgb[0][0] >> 3) << 11) | ((rgb[0][1] >> 2) << 5) | (rgb[0][2] >> 3));
+                    hi = (uint8_t)(c >> 8);
+                    lo = (uint8_t)(c & 0xFF);
+                    *p++ = (info.byte_swap != 0) ? lo : hi;
+                    *p++ = (info.byte_swap != 0) ? hi : lo;
+                    c = (uint16_t)(((rgb[1][0] >> 3) << 11) | ((rgb[1][1] >> 2) << 5) | (rgb[1][2] >> 3));
+                    hi = (uint8_t)(c >> 8);
+                    lo = (uint8_t)(c & 0xFF);
+                    *p++ = (info.byte_swap != 0) ? lo : hi;
+                    *p++ = (info.byte_swap != 0) ? hi : lo;
+                }
+                else if (info.format == SIM_DVP_FORMAT_YUV422)
+                {
+                    hi = (uint8_t)((a_sim_dvp_u(rgb[0]) + a_sim_dvp_u(rgb[1]) + 1) / 2);
+                    lo = (uint8_t)((a_sim_dvp_v(rgb[0]) + a_sim_dvp_v(rgb[1]) + 1) / 2);
+                    if (info.byte_swap != 0)
+                    {
+                        *p++ = hi;
+                        *p++ = a_sim_dvp_y(rgb[0]);
+                        *p++ = lo;
+                        *p++ = a_sim_dvp_y(rgb[1]);
+                    }
+                    else
+                    {
+                        *p++ = a_sim_dvp_y(rgb[0]);
+                        *p++ = hi;
+                        *p++ = a_sim_dvp_y(rgb[1]);
+                        *p++ = lo;
+                    }
+                }
+                else if (info.format == SIM_DVP_FORMAT_Y8)
+                {
+                    *p++ = a_sim_dvp_y(rgb[0]);
+                    *p++ = a_sim_dvp_y(rgb[1]);
+                }
+                else
+                {
+                    c = (uint16_t)(((y & 0x01) == 0 ? rgb[0][2] : rgb[0][1]) << 2);
+                    *p++ = (uint8_t)(c & 0xFF);
+                    *p++ = (uint8_t)(c >> 8);
+                    c = (uint16_t)(((y & 0x01) == 0 ? rgb[1][1] : rgb[1][0]) << 2);
+                    *p++ = (uint8_t)(c & 0xFF);
+                    *p++ = (uint8_t)(c >> 8);
+                }
+            }
+        }
+    }
+    gs_frame++;
+    gs_time += info.frame_us;
+    *timestamp_us = gs_time;
+    
+    return 0;
+}
@@ -0,0 +1,915 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      bench.c
+ * @brief     bench tool source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-16
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/16  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ov2640_basic.h"
+#include "sim_bus.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief bench list definition
+ * @note  every entry is run once in this order on the same simulated chip, SET runs the setter with the value,
+ *        GET runs the getter with a local buffer and CALL runs the function a_<name> of this file
+ */
+#define BENCH_LIST(SET, GET, CALL) \
+    CALL(ov2640_init)                                                                \
+    CALL(ov2640_table_init)                                                          \
+    CALL(ov2640_table_jpeg_init)                                                     \
+    CALL(ov2640_table_rgb565_init)                                                   \
+    SET(ov2640_set_agc_gain, 0x0010)                                                 \
+    GET(ov2640_get_agc_gain, uint16_t)                                               \
+    SET(ov2640_set_dummy_frame, OV2640_DUMMY_FRAME_1)                                \
+    GET(ov2640_get_dummy_frame, ov2640_dummy_frame_t)                                \
+    SET(ov2640_set_vertical_window_line_start, 0x0010)                               \
+    GET(ov2640_get_vertical_window_line_start, uint16_t)                             \
+    SET(ov2640_set_vertical_window_line_end, 0x0010)                                 \
+    GET(ov2640_get_vertical_window_line_end, uint16_t)                               \
+    SET(ov2640_set_horizontal_mirror, OV2640_BOOL_TRUE)                              \
+    GET(ov2640_get_horizontal_mirror, ov2640_bool_t)                                 \
+    SET(ov2640_set_vertical_flip, OV2640_BOOL_TRUE)                                  \
+    GET(ov2640_get_vertical_flip, ov2640_bool_t)                                     \
+    SET(ov2640_set_aec, 0x0100)                                                      \
+    GET(ov2640_get_aec, uint16_t)                                                    \
+    SET(ov2640_set_frame_exposure_pre_charge_row_number, 0x01)                       \
+    GET(ov2640_get_frame_exposure_pre_charge_row_number, uint8_t)                    \
+    SET(ov2640_set_mode, OV2640_MODE_NORMAL)                                         \
+    GET(ov2640_get_mode, ov2640_mode_t)                                              \
+    SET(ov2640_set_power_reset_pin_remap, OV2640_BOOL_FALSE)                         \
+    GET(ov2640_get_power_reset_pin_remap, ov2640_bool_t)                             \
+    SET(ov2640_set_output_drive, OV2640_OUTPUT_DRIVE_3_CAPABILITY)                   \
+    GET(ov2640_get_output_drive, ov2640_output_drive_t)                              \
+    SET(ov2640_set_band, OV2640_BAND_50HZ)                                           \
+    GET(ov2640_get_band, ov2640_band_t)                                              \
+    SET(ov2640_set_auto_band, OV2640_BOOL_TRUE)                                      \
+    GET(ov2640_get_auto_band, ov2640_bool_t)                                         \
+    SET(ov2640_set_live_video_after_snapshot, OV2640_BOOL_TRUE)                      \
+    GET(ov2640_get_live_video_after_snapshot, ov2640_bool_t)                         \
+    SET(ov2640_set_clock_output_power_down_pin_status, OV2640_PIN_STATUS_LAST_STATE) \
+    GET(ov2640_get_clock_output_power_down_pin_status, ov2640_pin_status_t)          \
+    SET(ov2640_set_clock_rate_double, OV2640_BOOL_TRUE)                              \
+    GET(ov2640_get_clock_rate_double, ov2640_bool_t)                                 \
+    SET(ov2640_set_clock_divider, 0x01)                                              \
+    GET(ov2640_get_clock_divider, uint8_t)                                           \
+    SET(ov2640_set_resolution, OV2640_RESOLUTION_UXGA)                               \
+    GET(ov2640_get_resolution, ov2640_resolution_t)                                  \
+    SET(ov2640_set_zoom, OV2640_BOOL_TRUE)                                           \
+    GET(ov2640_get_zoom, ov2640_bool_t)                                              \
+    SET(ov2640_set_color_bar_test, OV2640_BOOL_FALSE)                                \
+    GET(ov2640_get_color_bar_test, ov2640_bool_t)                                    \
+    SET(ov2640_set_band_filter, OV2640_BOOL_TRUE)                                    \
+    GET(ov2640_get_band_filter, ov2640_bool_t)                                       \
+    SET(ov2640_set_agc_control, OV2640_CONTROL_AUTO)                                 \
+    GET(ov2640_get_agc_control, ov2640_control_t)                                    \
+    SET(ov2640_set_exposure_control, OV2640_CONTROL_AUTO)                            \
+    GET(ov2640_get_exposure_control, ov2640_control_t)                               \
+    SET(ov2640_set_agc_gain_ceiling, OV2640_AGC_8X)                                  \
+    GET(ov2640_get_agc_gain_ceiling, ov2640_agc_gain_t)                              \
+    SET(ov2640_set_chsync_href_swap, OV2640_BOOL_TRUE)                               \
+    GET(ov2640_get_chsync_href_swap, ov2640_bool_t)                                  \
+    SET(ov2640_set_href_chsync_swap, OV2640_BOOL_TRUE)                               \
+    GET(ov2640_get_href_chsync_swap, ov2640_bool_t)                                  \
+    SET(ov2640_set_pclk_output_qualified_by_href, OV2640_BOOL_TRUE)                  \
+    GET(ov2640_get_pclk_output_qualified_by_href, ov2640_bool_t)                     \
+    SET(ov2640_set_pclk_edge, OV2640_EDGE_RISING)                                    \
+    GET(ov2640_get_pclk_edge, ov2640_edge_t)                                         \
+    SET(ov2640_set_href_polarity, OV2640_POLARITY_NEGATIVE)                          \
+    GET(ov2640_get_href_polarity, ov2640_polarity_t)                                 \
+    SET(ov2640_set_vsync_polarity, OV2640_POLARITY_NEGATIVE)                         \
+    GET(ov2640_get_vsync_polarity, ov2640_polarity_t)                                \
+    SET(ov2640_set_hsync_polarity, OV2640_POLARITY_NEGATIVE)                         \
+    GET(ov2640_get_hsync_polarity, ov2640_polarity_t)                                \
+    SET(ov2640_set_luminance_signal_high_range, 0x01)                                \
+    GET(ov2640_get_luminance_signal_high_range, uint8_t)                             \
+    SET(ov2640_set_luminance_signal_low_range, 0x01)                                 \
+    GET(ov2640_get_luminance_signal_low_range, uint8_t)                              \
+    CALL(ov2640_set_fast_mode_large_step_range)                                      \
+    CALL(ov2640_get_fast_mode_large_step_range)                                      \
+    SET(ov2640_set_line_interval_adjust, 0x0010)                                     \
+    GET(ov2640_get_line_interval_adjust, uint16_t)                                   \
+    SET(ov2640_set_hsync_position_and_width_end_point, 0x0010)                       \
+    GET(ov2640_get_hsync_position_and_width_end_point, uint16_t)                     \
+    SET(ov2640_set_hsync_position_and_width_start_point, 0x0010)                     \
+    GET(ov2640_get_hsync_position_and_width_start_point, uint16_t)                   \
+    SET(ov2640_set_vsync_pulse_width, 0x0010)                                        \
+    GET(ov2640_get_vsync_pulse_width, uint16_t)                                      \
+    SET(ov2640_set_luminance_average, 0x01)                                          \
+    GET(ov2640_get_luminance_average, uint8_t)                                       \
+    SET(ov2640_set_horizontal_window_start, 0x0010)                                  \
+    GET(ov2640_get_horizontal_window_start, uint16_t)                                \
+    SET(ov2640_set_horizontal_window_end, 0x0010)                                    \
+    GET(ov2640_get_horizontal_window_end, uint16_t)                                  \
+    SET(ov2640_set_pclk, OV2640_PCLK_DIVIDE_2)                                       \
+    GET(ov2640_get_pclk, ov2640_pclk_t)                                              \
+    SET(ov2640_set_zoom_window_horizontal_start_point, OV2640_BOOL_TRUE)             \
+    GET(ov2640_get_zoom_window_horizontal_start_point, ov2640_bool_t)                \
+    SET(ov2640_set_frame_length_adjustment, 0x0010)                                  \
+    GET(ov2640_get_frame_length_adjustment, uint16_t)                                \
+    SET(ov2640_set_zoom_mode_vertical_window_start_point, 0x0010)                    \
+    GET(ov2640_get_zoom_mode_vertical_window_start_point, uint16_t)                  \
+    SET(ov2640_set_flash_light, 0x01)                                                \
+    GET(ov2640_get_flash_light, uint8_t)                                             \
+    SET(ov2640_set_50hz_banding_aec, 0x0010)                                         \
+    GET(ov2640_get_50hz_banding_aec, uint16_t)                                       \
+    SET(ov2640_set_60hz_banding_aec, 0x0010)                                         \
+    GET(ov2640_get_60hz_banding_aec, uint16_t)                                       \
+    SET(ov2640_set_16_zone_average_weight_option, 0x55555555)                        \
+    GET(ov2640_get_16_zone_average_weight_option, uint32_t)                          \
+    SET(ov2640_set_histogram_algorithm_low_level, 0x01)                              \
+    GET(ov2640_get_histogram_algorithm_low_level, uint8_t)                           \
+    SET(ov2640_set_histogram_algorithm_high_level, 0x01)                             \
+    GET(ov2640_get_histogram_algorithm_high_level, uint8_t)                          \
+    SET(ov2640_set_dsp_bypass, OV2640_BOOL_FALSE)                                    \
+    GET(ov2640_get_dsp_bypass, ov2640_bool_t)                                        \
+    SET(ov2640_set_auto_mode, OV2640_BOOL_TRUE)                                      \
+    GET(ov2640_get_auto_mode, ov2640_bool_t)                                         \
+    SET(ov2640_set_dvp_pclk, 0x01)                                                   \
+    GET(ov2640_get_dvp_pclk, uint8_t)                                                \
+    SET(ov2640_set_dvp_y8, OV2640_BOOL_TRUE)                                         \
+    GET(ov2640_get_dvp_y8, ov2640_bool_t)                                            \
+    SET(ov2640_set_jpeg_output, OV2640_BOOL_TRUE)                                    \
+    GET(ov2640_get_jpeg_output, ov2640_bool_t)                                       \
+    SET(ov2640_set_dvp_output_format, OV2640_DVP_OUTPUT_FORMAT_YUV422)               \
+    GET(ov2640_get_dvp_output_format, ov2640_dvp_output_format_t)                    \
+    SET(ov2640_set_dvp_jpeg_output_href_timing, OV2640_HREF_TIMING_VSYNC)            \
+    GET(ov2640_get_dvp_jpeg_output_href_timing, ov2640_href_timing_t)                \
+    SET(ov2640_set_byte_swap, OV2640_BYTE_SWAP_UVUV)                                 \
+    GET(ov2640_get_byte_swap, ov2640_byte_swap_t)                                    \
+    CALL(ov2640_set_reset)                                                           \
+    CALL(ov2640_get_reset)                                                           \
+    SET(ov2640_set_sccb_master_speed, 0x01)                                          \
+    GET(ov2640_get_sccb_master_speed, uint8_t)                                       \
+    SET(ov2640_set_sccb_slave_id, 0x60)                                              \
+    GET(ov2640_get_sccb_slave_id, uint8_t)                                           \
+    SET(ov2640_set_address_auto_increase, OV2640_BOOL_TRUE)                          \
+    GET(ov2640_get_address_auto_increase, ov2640_bool_t)                             \
+    SET(ov2640_set_sccb, OV2640_BOOL_TRUE)                                           \
+    GET(ov2640_get_sccb, ov2640_bool_t)                                              \
+    SET(ov2640_set_sccb_master_clock_delay, OV2640_BOOL_TRUE)                        \
+    GET(ov2640_get_sccb_master_clock_delay, ov2640_bool_t)                           \
+    SET(ov2640_set_sccb_master_access, OV2640_BOOL_TRUE)                             \
+    GET(ov2640_get_sccb_master_access, ov2640_bool_t)                                \
+    SET(ov2640_set_sensor_pass_through_access, OV2640_BOOL_TRUE)                     \
+    GET(ov2640_get_sensor_pass_through_access, ov2640_bool_t)                        \
+    CALL(ov2640_set_bist)                                                            \
+    CALL(ov2640_get_bist)                                                            \
+    SET(ov2640_set_program_memory_pointer_address, 0x0000)                           \
+    GET(ov2640_get_program_memory_pointer_address, uint16_t)                         \
+    SET(ov2640_set_program_memory_pointer_access_address, 0x00)                      \
+    GET(ov2640_get_program_memory_pointer_access_address, uint8_t)                   \
+    SET(ov2640_set_sccb_protocol_command, 0x00)                                      \
+    GET(ov2640_get_sccb_protocol_command, uint8_t)                                   \
+    SET(ov2640_set_sccb_protocol_status, 0x00)                                       \
+    GET(ov2640_get_sccb_protocol_status, uint8_t)                                    \
+    SET(ov2640_set_cip, OV2640_BOOL_TRUE)                                            \
+    GET(ov2640_get_cip, ov2640_bool_t)                                               \
+    SET(ov2640_set_dmy, OV2640_BOOL_TRUE)                                            \
+    GET(ov2640_get_dmy, ov2640_bool_t)                                               \
+    SET(ov2640_set_raw_gma, OV2640_BOOL_TRUE)                                        \
+    GET(ov2640_get_raw_gma, ov2640_bool_t)                                           \
+    SET(ov2640_set_dg, OV2640_BOOL_TRUE)                                             \
+    GET(ov2640_get_dg, ov2640_bool_t)                                                \
+    SET(ov2640_set_awb, OV2640_BOOL_TRUE)                                            \
+    GET(ov2640_get_awb, ov2640_bool_t)                                               \
+    SET(ov2640_set_awb_gain, OV2640_BOOL_TRUE)                                       \
+    GET(ov2640_get_awb_gain, ov2640_bool_t)                                          \
+    SET(ov2640_set_lenc, OV2640_BOOL_TRUE)                                           \
+    GET(ov2640_get_lenc, ov2640_bool_t)                                              \
+    SET(ov2640_set_pre, OV2640_BOOL_TRUE)                                            \
+    GET(ov2640_get_pre, ov2640_bool_t)                                               \
+    SET(ov2640_set_aec_enable, OV2640_BOOL_TRUE)                                     \
+    GET(ov2640_get_aec_enable, ov2640_bool_t)                                        \
+    SET(ov2640_set_aec_sel, OV2640_BOOL_TRUE)                                        \
+    GET(ov2640_get_aec_sel, ov2640_bool_t)                                           \
+    SET(ov2640_set_stat_sel, OV2640_BOOL_TRUE)                                       \
+    GET(ov2640_get_stat_sel, ov2640_bool_t)                                          \
+    SET(ov2640_set_vfirst, OV2640_BOOL_TRUE)                                         \
+    GET(ov2640_get_vfirst, ov2640_bool_t)                                            \
+    SET(ov2640_set_yuv422, OV2640_BOOL_TRUE)                                         \
+    GET(ov2640_get_yuv422, ov2640_bool_t)                                            \
+    SET(ov2640_set_yuv, OV2640_BOOL_TRUE)                                            \
+    GET(ov2640_get_yuv, ov2640_bool_t)                                               \
+    SET(ov2640_set_rgb, OV2640_BOOL_TRUE)                                            \
+    GET(ov2640_get_rgb, ov2640_bool_t)                                               \
+    SET(ov2640_set_raw, OV2640_BOOL_TRUE)                                            \
+    GET(ov2640_get_raw, ov2640_bool_t)                                               \
+    SET(ov2640_set_dcw, OV2640_BOOL_TRUE)                                            \
+    GET(ov2640_get_dcw, ov2640_bool_t)                                               \
+    SET(ov2640_set_sde, OV2640_BOOL_TRUE)                                            \
+    GET(ov2640_get_sde, ov2640_bool_t)                                               \
+    SET(ov2640_set_uv_adj, OV2640_BOOL_TRUE)                                         \
+    GET(ov2640_get_uv_adj, ov2640_bool_t)                                            \
+    SET(ov2640_set_uv_avg, OV2640_BOOL_TRUE)                                         \
+    GET(ov2640_get_uv_avg, ov2640_bool_t)                                            \
+    SET(ov2640_set_cmx, OV2640_BOOL_TRUE)                                            \
+    GET(ov2640_get_cmx, ov2640_bool_t)                                               \
+    SET(ov2640_set_bpc, OV2640_BOOL_TRUE)                                            \
+    GET(ov2640_get_bpc, ov2640_bool_t)                                               \
+    SET(ov2640_set_wpc, OV2640_BOOL_TRUE)                                            \
+    GET(ov2640_get_wpc, ov2640_bool_t)                                               \
+    SET(ov2640_set_sde_indirect_register_address, 0x00)                              \
+    GET(ov2640_get_sde_indirect_register_address, uint8_t)                           \
+    SET(ov2640_set_sde_indirect_register_data, 0x20)                                 \
+    GET(ov2640_get_sde_indirect_register_data, uint8_t)                              \
+    SET(ov2640_set_image_horizontal, 0x0010)                                         \
+    GET(ov2640_get_image_horizontal, uint16_t)                                       \
+    SET(ov2640_set_image_vertical, 0x0010)                                           \
+    GET(ov2640_get_image_vertical, uint16_t)                                         \
+    SET(ov2640_set_quantization_scale_factor, 0x0C)                                  \
+    GET(ov2640_get_quantization_scale_factor, uint8_t)                               \
+    SET(ov2640_set_lp_dp, OV2640_BOOL_TRUE)                                          \
+    GET(ov2640_get_lp_dp, ov2640_bool_t)                                             \
+    SET(ov2640_set_round, OV2640_BOOL_TRUE)                                          \
+    GET(ov2640_get_round, ov2640_bool_t)                                             \
+    SET(ov2640_set_vertical_divider, 0x01)                                           \
+    GET(ov2640_get_vertical_divider, uint8_t)                                        \
+    SET(ov2640_set_horizontal_divider, 0x01)                                         \
+    GET(ov2640_get_horizontal_divider, uint8_t)                                      \
+    SET(ov2640_set_horizontal_size, 0x0010)                                          \
+    GET(ov2640_get_horizontal_size, uint16_t)                                        \
+    SET(ov2640_set_vertical_size, 0x0010)                                            \
+    GET(ov2640_get_vertical_size, uint16_t)                                          \
+    SET(ov2640_set_offset_x, 0x0010)                                                 \
+    GET(ov2640_get_offset_x, uint16_t)                                               \
+    SET(ov2640_set_offset_y, 0x0010)                                                 \
+    GET(ov2640_get_offset_y, uint16_t)                                               \
+    SET(ov2640_set_dp_selx, 0x01)                                                    \
+    GET(ov2640_get_dp_selx, uint8_t)                                                 \
+    SET(ov2640_set_dp_sely, 0x01)                                                    \
+    GET(ov2640_get_dp_sely, uint8_t)                                                 \
+    SET(ov2640_set_output_width, 0x0010)                                             \
+    GET(ov2640_get_output_width, uint16_t)                                           \
+    SET(ov2640_set_output_height, 0x0010)                                            \
+    GET(ov2640_get_output_height, uint16_t)                                          \
+    SET(ov2640_set_zoom_speed, 0x01)                                                 \
+    GET(ov2640_get_zoom_speed, uint8_t)                                              \
+    SET(ov2640_set_light_mode, OV2640_LIGHT_MODE_SUNNY)                              \
+    SET(ov2640_set_color_saturation, OV2640_COLOR_SATURATION_POSITIVE_1)             \
+    SET(ov2640_set_brightness, OV2640_BRIGHTNESS_POSITIVE_1)                         \
+    SET(ov2640_set_contrast, OV2640_CONTRAST_POSITIVE_1)                             \
+    SET(ov2640_set_special_effect, OV2640_SPECIAL_EFFECT_NORMAL)                     \
+    CALL(ov2640_set_dsp_reg)                                                         \
+    CALL(ov2640_get_dsp_reg)                                                         \
+    CALL(ov2640_set_sensor_reg)                                                      \
+    CALL(ov2640_get_sensor_reg)                                                      \
+    SET(ov2640_set_burst_write, OV2640_BOOL_TRUE)                                    \
+    GET(ov2640_get_burst_write, ov2640_bool_t)                                       \
+    CALL(ov2640_get_state)                                                           \
+    GET(ov2640_get_skipped_write_count, uint32_t)                                    \
+    SET(ov2640_set_queue_mode, OV2640_BOOL_FALSE)                                    \
+    GET(ov2640_get_queue_mode, ov2640_bool_t)                                        \
+    CALL(ov2640_set_retry)                                                           \
+    CALL(ov2640_get_retry)                                                           \
+    GET(ov2640_get_error_stats, ov2640_error_stats_t)                                \
+    CALL(ov2640_get_register_checksum)                                               \
+    CALL(ov2640_get_register_failure_count)                                          \
+    SET(ov2640_set_ready_polling, 0)                                                 \
+    GET(ov2640_get_ready_polling, uint16_t)                                          \
+    GET(ov2640_get_ready_stats, ov2640_ready_stats_t)                                \
+    CALL(ov2640_set_table_verify)                                                    \
+    GET(ov2640_get_table_verify, ov2640_bool_t)                                      \
+    GET(ov2640_get_table_mismatch_count, uint16_t)                                   \
+    CALL(ov2640_set_trace)                                                           \
+    CALL(ov2640_get_trace)                                                           \
+    CALL(ov2640_get_perf_stats)                                                      \
+    GET(ov2640_get_bus_stats, ov2640_bus_stats_t)                                    \
+    CALL(ov2640_basic_init)
+
+/**
+ * @brief bench entry structure definition
+ */
+typedef struct bench_entry_s
+{
+    const char *name;              /**< api name */
+    uint8_t (*run)(void);          /**< run function */
+} bench_entry_t;
+
+/**
+ * @brief bench model max definition
+ */
+#define BENCH_MODEL_MAX        3          /**< max cost models in one table */
+
+static ov2640_handle_t gs_handle;                                              /**< ov2640 handle */
+static const sim_bus_model_t gsc_model[BENCH_MODEL_MAX] =
+{
+    {100000, 0},                                                               /* 100khz */
+    {400000, 0},                                                               /* 400khz */
+    {50000, 20},                                                               /* bit banged gpio */
+};
+static const char *const gsc_model_name[BENCH_MODEL_MAX] = {"us_100k", "us_400k", "us_bitbang"};     /**< model column names */
+
+/**
+ * @brief     quiet debug print
+ * @param[in] fmt format data
+ * @note      the driver messages go to stderr so that stdout is a clean table
+ */
+static void a_print(const char *const fmt, ...)
+{
+    va_list args;
+    
+    va_start(args, fmt);
+    (void)vfprintf(stderr, fmt, args);
+    va_end(args);
+}
+
+/**
+ * @brief  link and init the chip
+ * @return status code
+ *         - 0 success
+ *         - 1 init failed
+ * @note   none
+ */
+static uint8_t a_ov2640_init(void)
+{
+    DRIVER_OV2640_LINK_INIT(&gs_handle, ov2640_handle_t);
+    DRIVER_OV2640_LINK_SCCB_INIT(&gs_handle, ov2640_interface_sccb_init);
+    DRIVER_OV2640_LINK_SCCB_DEINIT(&gs_handle, ov2640_interface_sccb_deinit);
+    DRIVER_OV2640_LINK_SCCB_READ(&gs_handle, ov2640_interface_sccb_read);
+    DRIVER_OV2640_LINK_SCCB_WRITE(&gs_handle, ov2640_interface_sccb_write);
+    DRIVER_OV2640_LINK_POWER_DOWN_INIT(&gs_handle, ov2640_interface_power_down_init);
+    DRIVER_OV2640_LINK_POWER_DOWN_DEINIT(&gs_handle, ov2640_interface_power_down_deinit);
+    DRIVER_OV2640_LINK_POWER_DOWN_WRITE(&gs_handle, ov2640_interface_power_down_write);
+    DRIVER_OV2640_LINK_RESET_INIT(&gs_handle, ov2640_interface_reset_init);
+    DRIVER_OV2640_LINK_RESET_DEINIT(&gs_handle, ov2640_interface_reset_deinit);
+    DRIVER_OV2640_LINK_RESET_WRITE(&gs_handle, ov2640_interface_reset_write);
+    DRIVER_OV2640_LINK_DELAY_MS(&gs_handle, ov2640_interface_delay_ms);
+    DRIVER_OV2640_LINK_DEBUG_PRINT(&gs_handle, a_print);
+    
+    return ov2640_init(&gs_handle);
+}
+
+/**
+ * @brief  table init
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_ov2640_table_init(void)
+{
+    return ov2640_table_init(&gs_handle);
+}
+
+/**
+ * @brief  table jpeg init
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_ov2640_table_jpeg_init(void)
+{
+    return ov2640_table_jpeg_init(&gs_handle);
+}
+
+/**
+ * @brief  table rgb565 init
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_ov2640_table_rgb565_init(void)
+{
+    return ov2640_table_rgb565_init(&gs_handle);
+}
+
+/**
+ * @brief  set fast mode large step range
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_ov2640_set_fast_mode_large_step_range(void)
+{
+    return ov2640_set_fast_mode_large_step_range(&gs_handle, 0x02, 0x01);
+}
+
+/**
+ * @brief  get fast mode large step range
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_ov2640_get_fast_mode_large_step_range(void)
+{
+    uint8_t high;
+    uint8_t low;
+    
+    return ov2640_get_fast_mode_large_step_range(&gs_handle, &high, &low);
+}
+
+/**
+ * @brief  set reset
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_ov2640_set_reset(void)
+{
+    return ov2640_set_reset(&gs_handle, OV2640_RESET_DVP, OV2640_BOOL_FALSE);
+}
+
+/**
+ * @brief  get reset
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_ov2640_get_reset(void)
+{
+    ov2640_bool_t enable;
+    
+    return ov2640_get_reset(&gs_handle, OV2640_RESET_DVP, &enable);
+}
+
+/**
+ * @brief  set bist
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_ov2640_set_bist(void)
+{
+    return ov2640_set_bist(&gs_handle, OV2640_BIST_BOOT_ROM, OV2640_BOOL_FALSE);
+}
+
+/**
+ * @brief  get bist
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_ov2640_get_bist(void)
+{
+    ov2640_bool_t enable;
+    
+    return ov2640_get_bist(&gs_handle, OV2640_BIST_BOOT_ROM, &enable);
+}
+
+/**
+ * @brief  set dsp reg
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_ov2640_set_dsp_reg(void)
+{
+    return ov2640_set_dsp_reg(&gs_handle, 0x44, 0x0C);
+}
+
+/**
+ * @brief  get dsp reg
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_ov2640_get_dsp_reg(void)
+{
+    uint8_t data;
+    
+    return ov2640_get_dsp_reg(&gs_handle, 0x44, &data);
+}
+
+/**
+ * @brief  set sensor reg
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_ov2640_set_sensor_reg(void)
+{
+    return ov2640_set_sensor_reg(&gs_handle, 0x03, 0x0A);
+}
+
+/**
+ * @brief  get sensor reg
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_ov2640_get_sensor_reg(void)
+{
+    uint8_t data;
+    
+    return ov2640_get_sensor_reg(&gs_handle, 0x03, &data);
+}
+
+/**
+ * @brief  get state
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_ov2640_get_state(void)
+{
+    static ov2640_state_t state;
+    
+    return ov2640_get_state(&gs_handle, &state);
+}
+
+/**
+ * @brief  set retry
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_ov2640_set_retry(void)
+{
+    return ov2640_set_retry(&gs_handle, 0, 1, 8);
+}
+
+/**
+ * @brief  get retry
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_ov2640_get_retry(void)
+{
+    uint8_t times;
+    uint16_t delay_ms;
+    uint16_t max_delay_ms;
+    
+    return ov2640_get_retry(&gs_handle, &times, &delay_ms, &max_delay_ms);
+}
+
+/**
+ * @brief  get register checksum
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_ov2640_get_register_checksum(void)
+{
+    static const ov2640_key_register_t keys[2] =
+    {
+        {OV2640_BANK_DSP, 0xDA, 0xFF},
+        {OV2640_BANK_SENSOR, 0x12, 0x70},
+    };
+    uint16_t checksum;
+    
+    return ov2640_get_register_checksum(&gs_handle, keys, 2, &checksum);
+}
+
+/**
+ * @brief  get register failure count
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   0 when the feature is compiled out
+ */
+static uint8_t a_ov2640_get_register_failure_count(void)
+{
+#if (OV2640_FAIL_COUNT_ENABLE == 1)
+    uint8_t count;
+    
+    return ov2640_get_register_failure_count(&gs_handle, OV2640_BANK_DSP, 0x44, &count);
+#else
+    return 0;
+#endif
+}
+
+/**
+ * @brief  set table verify
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_ov2640_set_table_verify(void)
+{
+    return ov2640_set_table_verify(&gs_handle, OV2640_BOOL_FALSE, NULL, 0);
+}
+
+/**
+ * @brief  set trace
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   0 when the feature is compiled out
+ */
+static uint8_t a_ov2640_set_trace(void)
+{
+#if (OV2640_TRACE_ENABLE == 1)
+    static ov2640_trace_entry_t trace[64];
+    
+    return ov2640_set_trace(&gs_handle, trace, 64);
+#else
+    return 0;
+#endif
+}
+
+/**
+ * @brief  get trace
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   0 when the feature is compiled out
+ */
+static uint8_t a_ov2640_get_trace(void)
+{
+#if (OV2640_TRACE_ENABLE == 1)
+    uint16_t first;
+    uint16_t count;
+    uint32_t total;
+    
+    return ov2640_get_trace(&gs_handle, &first, &count, &total);
+#else
+    return 0;
+#endif
+}
+
+/**
+ * @brief  get perf stats
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   0 when the feature is compiled out
+ */
+static uint8_t a_ov2640_get_perf_stats(void)
+{
+#if (OV2640_PERF_ENABLE == 1)
+    ov2640_perf_stats_t stats;
+    
+    return ov2640_get_perf_stats(&gs_handle, OV2640_PERF_SCCB_WRITE, &stats);
+#else
+    return 0;
+#endif
+}
+
+/**
+ * @brief  basic init
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   the handle of this file is released first, the basic example uses its own handle
+ */
+static uint8_t a_ov2640_basic_init(void)
+{
+    uint8_t res;
+    
+    (void)ov2640_deinit(&gs_handle);
+    sim_bus_clear_stats();
+    res = ov2640_basic_init();
+    
+    return res;
+}
+
+#define BENCH_SET_FUNC(fn, value) static uint8_t a_##fn(void) { return fn(&gs_handle, value); }
+#define BENCH_GET_FUNC(fn, type)  static uint8_t a_##fn(void) { type v; return fn(&gs_handle, &v); }
+#define BENCH_NONE(fn)
+BENCH_LIST(BENCH_SET_FUNC, BENCH_GET_FUNC, BENCH_NONE)
+
+#define BENCH_ENTRY2(fn, arg) {#fn, a_##fn},
+#define BENCH_ENTRY1(fn)      {#fn, a_##fn},
+static const bench_entry_t gsc_bench[] = {BENCH_LIST(BENCH_ENTRY2, BENCH_ENTRY2, BENCH_ENTRY1)};        /**< bench entries */
+
+#define BENCH_COUNT (sizeof(gsc_bench) / sizeof(gsc_bench[0]))        /**< bench entry count */
+
+static sim_bus_stats_t gs_stats[BENCH_COUNT];        /**< stats of every entry */
+static uint8_t gs_res[BENCH_COUNT];                  /**< result of every entry */
+
+/**
+ * @brief  run all entries
+ * @return status code
+ *         - 0 success
+ *         - 1 an entry failed
+ * @note   none
+ */
+static uint8_t a_run(void)
+{
+    uint8_t res;
+    uint16_t i;
+    
+    res = 0;
+    for (i = 0; i < BENCH_COUNT; i++)
+    {
+        sim_bus_clear_stats();
+        gs_res[i] = gsc_bench[i].run();
+        sim_bus_get_stats(&gs_stats[i]);
+        if (gs_res[i] != 0)
+        {
+            res = 1;
+        }
+    }
+    (void)ov2640_basic_deinit();
+    
+    return res;
+}
+
+/**
+ * @brief     print the table
+ * @param[in] *model pointer to a cost model list
+ * @param[in] **name pointer to a model column name list
+ * @param[in] count model count
+ * @note      one csv line per entry, the bytes are all bytes on the wire including the address and the register
+ */
+static void a_print_table(const sim_bus_model_t *model, const char *const *name, uint8_t count)
+{
+    uint16_t i;
+    uint8_t m;
+    
+    printf("name,transactions,bytes,bank_switches,delay_us");
+    for (m = 0; m < count; m++)
+    {
+        printf(",%s", name[m]);
+    }
+    printf(",res\n");
+    for (i = 0; i < BENCH_COUNT; i++)
+    {
+        printf("%s,%u,%u,%u,%u", gsc_bench[i].name,
+               (unsigned)(gs_stats[i].read + gs_stats[i].write + gs_stats[i].nack),
+               (unsigned)sim_bus_phases(&gs_stats[i]), (unsigned)gs_stats[i].bank_switch,
+               (unsigned)gs_stats[i].wait_us);
+        for (m = 0; m < count; m++)
+        {
+            printf(",%u", (unsigned)sim_bus_estimate(&gs_stats[i], &model[m]));
+        }
+        printf(",%d\n", gs_res[i]);
+    }
+}
+
+/**
+ * @brief     check against a baseline
+ * @param[in] *path pointer to a baseline file path
+ * @return    status code
+ *            - 0 success
+ *            - 1 check failed
+ * @note      an entry regresses when it needs more transactions or more bytes than the baseline or fails,
+ *            entries missing from the baseline are reported as new
+ */
+static uint8_t a_check(const char *path)
+{
+    FILE *f;
+    char line[256];
+    char name[128];
+    unsigned int transactions;
+    unsigned int bytes;
+    unsigned int cur_transactions;
+    unsigned int cur_bytes;
+    uint16_t i;
+    uint16_t found;
+    uint16_t regressions;
+    uint16_t improvements;
+    uint16_t missing;
+    static uint8_t seen[BENCH_COUNT];
+    
+    f = fopen(path, "r");
+    if (f == NULL)
+    {
+        printf("ov2640: can't open %s.\n", path);
+        
+        return 1;
+    }
+    memset(seen, 0, sizeof(seen));
+    regressions = 0;
+    improvements = 0;
+    missing = 0;
+    while (fgets(line, sizeof(line), f) != NULL)
+    {
+        if (sscanf(line, "%127[^,],%u,%u", name, &transactions, &bytes) != 3)
+        {
+            continue;
+        }
+        found = BENCH_COUNT;
+        for (i = 0; i < BENCH_COUNT; i++)
+        {
+            if (strcmp(gsc_bench[i].name, name) == 0)
+            {
+                found = i;
+                
+                break;
+            }
+        }
+        if (found == BENCH_COUNT)
+        {
+            printf("ov2640: %s is missing.\n", name);
+            missing++;
+            
+            continue;
+        }
+        seen[found] = 1;
+        cur_transactions = gs_stats[found].read + gs_stats[found].write + gs_stats[found].nack;
+        cur_bytes = sim_bus_phases(&gs_stats[found]);
+        if ((gs_res[found] != 0) || (cur_transactions > transactions) || (cur_bytes > bytes))
+        {
+            printf("ov2640: regression %s, transactions %u -> %u, bytes %u -> %u, res %d.\n",
+                   name, transactions, cur_transactions, bytes, cur_bytes, gs_res[found]);
+            regressions++;
+        }
+        else if ((cur_transactions < transactions) || (cur_bytes < bytes))
+        {
+            printf("ov2640: improvement %s, transactions %u -> %u, bytes %u -> %u.\n",
+                   name, transactions, cur_transactions, bytes, cur_bytes);
+            improvements++;
+        }
+    }
+    (void)fclose(f);
+    for (i = 0; i < BENCH_COUNT; i++)
+    {
+        if (seen[i] == 0)
+        {
+            printf("ov2640: %s is new.\n", gsc_bench[i].name);
+        }
+    }
+    printf("ov2640: %d apis, %d regressions, %d improvements, %d missing.\n",
+           (int)BENCH_COUNT, regressions, improvements, missing);
+    printf("ov2640: check bench result %s.\n", ((regressions == 0) && (missing == 0)) ? "ok" : "error");
+    
+    return ((regressions == 0) && (missing == 0)) ? 0 : 1;
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      "run" prints the table with the 100khz, 400khz and bit banged models,
+ *            "model <hz> <overhead_us>" prints the table with one model, "check <baseline>" compares with a baseline
+ */
+int main(int argc, char **argv)
+{
+    uint8_t res;
+    sim_bus_model_t model;
+    static const char *const model_name[1] = {"us"};
+    
+    res = a_run();
+    if ((argc < 2) || (strcmp(argv[1], "run") == 0))
+    {
+        a_print_table(gsc_model, gsc_model_name, BENCH_MODEL_MAX);
+        
+        return res;
+    }
+    if ((strcmp(argv[1], "model") == 0) && (argc == 4))
+    {
+        model.clock_hz = (uint32_t)strtoul(argv[2], NULL, 0);
+        model.overhead_us = (uint32_t)strtoul(argv[3], NULL, 0);
+        if (model.clock_hz == 0)
+        {
+            printf("ov2640: clock is invalid.\n");
+            
+            return 1;
+        }
+        a_print_table(&model, model_name, 1);
+        
+        return res;
+    }
+    if ((strcmp(argv[1], "check") == 0) && (argc == 3))
+    {
+        return a_check(argv[2]);
+    }
+    printf("ov2640: usage ov2640_bench [run | model <hz> <overhead_us> | check <baseline>].\n");
+    
+    return 1;
+}
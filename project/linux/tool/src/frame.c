@@ -0,0 +1,613 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      frame.c
+ * @brief     frame tool source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-16
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/16  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include "driver_ov2640.h"
+#include "driver_ov2640_interface.h"
+#include "sim_dvp.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/**
+ * @brief frame tool definition
+ */
+#define FRAME_BUFFER_SIZE        (1600 * 1200 * 2)        /**< uxga 2 bytes per pixel */
+#define FRAME_FORMAT_MAX         5                        /**< format count */
+
+static ov2640_handle_t gs_handle;                                                                /**< ov2640 handle */
+static uint8_t gs_buf[FRAME_BUFFER_SIZE];                                                        /**< frame buffer */
+static const char *const gsc_format_name[FRAME_FORMAT_MAX] = {"yuv422", "raw10", "rgb565", "y8", "jpeg"};        /**< format names */
+
+/**
+ * @brief     quiet debug print
+ * @param[in] fmt format data
+ * @note      the driver messages go to stderr
+ */
+static void a_print(const char *const fmt, ...)
+{
+    va_list args;
+    
+    va_start(args, fmt);
+    (void)vfprintf(stderr, fmt, args);
+    va_end(args);
+}
+
+/**
+ * @brief  init the chip
+ * @return status code
+ *         - 0 success
+ *         - 1 init failed
+ * @note   the chip is loaded with the init and the rgb565 tables
+ */
+static uint8_t a_init(void)
+{
+    DRIVER_OV2640_LINK_INIT(&gs_handle, ov2640_handle_t);
+    DRIVER_OV2640_LINK_SCCB_INIT(&gs_handle, ov2640_interface_sccb_init);
+    DRIVER_OV2640_LINK_SCCB_DEINIT(&gs_handle, ov2640_interface_sccb_deinit);
+    DRIVER_OV2640_LINK_SCCB_READ(&gs_handle, ov2640_interface_sccb_read);
+    DRIVER_OV2640_LINK_SCCB_WRITE(&gs_handle, ov2640_interface_sccb_write);
+    DRIVER_OV2640_LINK_POWER_DOWN_INIT(&gs_handle, ov2640_interface_power_down_init);
+    DRIVER_OV2640_LINK_POWER_DOWN_DEINIT(&gs_handle, ov2640_interface_power_down_deinit);
+    DRIVER_OV2640_LINK_POWER_DOWN_WRITE(&gs_handle, ov2640_interface_power_down_write);
+    DRIVER_OV2640_LINK_RESET_INIT(&gs_handle, ov2640_interface_reset_init);
+    DRIVER_OV2640_LINK_RESET_DEINIT(&gs_handle, ov2640_interface_reset_deinit);
+    DRIVER_OV2640_LINK_RESET_WRITE(&gs_handle, ov2640_interface_reset_write);
+    DRIVER_OV2640_LINK_DELAY_MS(&gs_handle, ov2640_interface_delay_ms);
+    DRIVER_OV2640_LINK_DEBUG_PRINT(&gs_handle, a_print);
+    DRIVER_OV2640_LINK_TIMESTAMP_US(&gs_handle, ov2640_interface_timestamp_us);
+    
+    if (ov2640_init(&gs_handle) != 0)
+    {
+        return 1;
+    }
+    if ((ov2640_table_init(&gs_handle) != 0) || (ov2640_table_rgb565_init(&gs_handle) != 0))
+    {
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    sim_dvp_reset();
+    
+    return 0;
+}
+
+/**
+ * @brief     parse a format name
+ * @param[in] *name pointer to a format name
+ * @return    format or FRAME_FORMAT_MAX
+ * @note      none
+ */
+static uint8_t a_format_parse(const char *name)
+{
+    uint8_t i;
+    
+    for (i = 0; i < FRAME_FORMAT_MAX; i++)
+    {
+        if (strcmp(name, gsc_format_name[i]) == 0)
+        {
+            break;
+        }
+    }
+    
+    return i;
+}
+
+/**
+ * @brief     set the output format
+ * @param[in] format frame format
+ * @return    status code
+ *            - 0 success
+ *            - 1 set failed
+ * @note      y8 and jpeg are set on top of the yuv422 dvp format, like the jpeg table does
+ */
+static uint8_t a_format_set(sim_dvp_format_t format)
+{
+    uint8_t res;
+    
+    res = ov2640_set_jpeg_output(&gs_handle, (format == SIM_DVP_FORMAT_JPEG) ? OV2640_BOOL_TRUE : OV2640_BOOL_FALSE);
+    res |= ov2640_set_dvp_y8(&gs_handle, (format == SIM_DVP_FORMAT_Y8) ? OV2640_BOOL_TRUE : OV2640_BOOL_FALSE);
+    if (format <= SIM_DVP_FORMAT_RGB565)
+    {
+        res |= ov2640_set_dvp_output_format(&gs_handle, (ov2640_dvp_output_format_t)format);
+    }
+    else
+    {
+        res |= ov2640_set_dvp_output_format(&gs_handle, OV2640_DVP_OUTPUT_FORMAT_YUV422);
+    }
+    
+    return (res != 0) ? 1 : 0;
+}
+
+/**
+ * @brief     set the output size
+ * @param[in] width output width
+ * @param[in] height output height
+ * @return    status code
+ *            - 0 success
+ *            - 1 set failed
+ * @note      the size registers hold the size divided by 4
+ */
+static uint8_t a_size_set(uint16_t width, uint16_t height)
+{
+    if ((ov2640_set_output_width(&gs_handle, width / 4) != 0) ||
+        (ov2640_set_output_height(&gs_handle, height / 4) != 0))
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     print the frame information
+ * @param[in] *info pointer to a frame information structure
+ * @note      none
+ */
+static void a_info_print(const sim_dvp_info_t *info)
+{
+    printf("ov2640: %s %dx%d, pclk %u hz, %u bytes, frame %u us, %.2f fps, %.2f MB/s.\n",
+           gsc_format_name[info->format], info->width, info->height, (unsigned)info->pclk_hz,
+           (unsigned)info->frame_size, (unsigned)info->frame_us, 1000000.0 / info->frame_us,
+           (double)info->frame_size / info->frame_us);
+}
+
+/**
+ * @brief     run the info command
+ * @param[in] width output width
+ * @param[in] height output height
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      every format is printed at the same size
+ */
+static uint8_t a_info_run(uint16_t width, uint16_t height)
+{
+    sim_dvp_info_t info;
+    uint8_t i;
+    
+    if (a_size_set(width, height) != 0)
+    {
+        return 1;
+    }
+    for (i = 0; i < FRAME_FORMAT_MAX; i++)
+    {
+        if ((a_format_set((sim_dvp_format_t)i) != 0) || (sim_dvp_get_info(&info) != 0))
+        {
+            return 1;
+        }
+        a_info_print(&info);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     run the dump command
+ * @param[in] format frame format
+ * @param[in] count frame count
+ * @param[in] *path pointer to an output file path
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      the frames are written back to back
+ */
+static uint8_t a_dump_run(sim_dvp_format_t format, uint32_t count, const char *path)
+{
+    FILE *f;
+    sim_dvp_info_t info;
+    uint32_t i;
+    uint32_t len;
+    uint64_t total;
+    uint64_t timestamp;
+    
+    if ((a_format_set(format) != 0) || (sim_dvp_get_info(&info) != 0))
+    {
+        return 1;
+    }
+    f = fopen(path, "wb");
+    if (f == NULL)
+    {
+        printf("ov2640: can't open %s.\n", path);
+        
+        return 1;
+    }
+    a_info_print(&info);
+    total = 0;
+    for (i = 0; i < count; i++)
+    {
+        if ((sim_dvp_capture(gs_buf, FRAME_BUFFER_SIZE, &len, &timestamp) != 0) ||
+            (fwrite(gs_buf, 1, len, f) != len))
+        {
+            (void)fclose(f);
+            
+            return 1;
+        }
+        total += len;
+    }
+    (void)fclose(f);
+    printf("ov2640: %u frames, %llu bytes, %llu us.\n", (unsigned)count, (unsigned long long)total,
+           (unsigned long long)timestamp);
+    
+    return 0;
+}
+
+/**
+ * @brief  get the host time
+ * @return time in us
+ * @note   monotonic clock
+ */
+static uint64_t a_now_us(void)
+{
+    struct timespec ts;
+    
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint64_t)ts.tv_sec * 1000000 + (uint64_t)ts.tv_nsec / 1000;
+}
+
+/**
+ * @brief     run the stream command
+ * @param[in] format frame format
+ * @param[in] count frame count
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      every frame is handed over when its modelled end time is reached on the host clock and then
+ *            summed like a consumer that touches every byte, a late frame means the host path is slower
+ *            than the modelled dvp rate
+ */
+static uint8_t a_stream_run(sim_dvp_format_t format, uint32_t count)
+{
+    sim_dvp_info_t info;
+    struct timespec ts;
+    uint32_t i;
+    uint32_t j;
+    uint32_t len;
+    uint32_t late;
+    uint32_t sum;
+    uint64_t start;
+    uint64_t now;
+    uint64_t total;
+    uint64_t timestamp;
+    
+    if ((a_format_set(format) != 0) || (sim_dvp_get_info(&info) != 0))
+    {
+        return 1;
+    }
+    a_info_print(&info);
+    sim_dvp_reset();
+    late = 0;
+    sum = 0;
+    total = 0;
+    start = a_now_us();
+    for (i = 0; i < count; i++)
+    {
+        if (sim_dvp_capture(gs_buf, FRAME_BUFFER_SIZE, &len, &timestamp) != 0)
+        {
+            return 1;
+        }
+        now = a_now_us() - start;
+        if (now < timestamp)
+        {
+            ts.tv_sec = (time_t)((timestamp - now) / 1000000);
+            ts.tv_nsec = (long)((timestamp - now) % 1000000) * 1000;
+            (void)nanosleep(&ts, NULL);
+        }
+        else
+        {
+            late++;
+        }
+        for (j = 0; j < len; j++)
+        {
+            sum += gs_buf[j];
+        }
+        total += len;
+    }
+    now = a_now_us() - start;
+    printf("ov2640: %u frames, %u late, %.2f fps, %.2f MB/s, sum 0x%08X.\n", (unsigned)count, (unsigned)late,
+           (double)count * 1000000.0 / now, (double)total / now, (unsigned)sum);
+    
+    return 0;
+}
+
+/**
+ * @brief     run one control loop step
+ * @param[in] frame frame index
+ * @return    status code
+ *            - 0 success
+ *            - 1 step failed
+ * @note      an exposure and gain update every frame and a brightness update every 8th frame
+ */
+static uint8_t a_control_step(uint32_t frame)
+{
+    static const ov2640_brightness_t brightness[2] = {OV2640_BRIGHTNESS_0, OV2640_BRIGHTNESS_POSITIVE_1};
+    uint8_t res;
+    uint16_t aec;
+    
+    res = ov2640_get_aec(&gs_handle, &aec);
+    res |= ov2640_set_aec(&gs_handle, (uint16_t)(aec ^ ((frame & 0x07) + 1)));
+    res |= ov2640_set_agc_gain(&gs_handle, (uint16_t)(0x10 + (frame & 0x0F)));
+    if ((frame & 0x07) == 0)
+    {
+        res |= ov2640_set_brightness(&gs_handle, brightness[(frame >> 3) & 0x01]);
+    }
+    
+    return (res != 0) ? 1 : 0;
+}
+
+/**
+ * @brief     run the budget command
+ * @param[in] format frame format
+ * @param[in] count frame count
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      the bus time of the control loop is read from the driver bus stats after every frame
+ *            and compared with the frame interval
+ */
+static uint8_t a_budget_run(sim_dvp_format_t format, uint32_t count)
+{
+    sim_dvp_info_t info;
+    ov2640_bus_stats_t prev;
+    ov2640_bus_stats_t stats;
+    uint32_t i;
+    uint32_t len;
+    uint32_t us;
+    uint32_t max;
+    uint64_t total;
+    uint64_t timestamp;
+    
+    if ((count == 0) || (a_format_set(format) != 0) || (sim_dvp_get_info(&info) != 0))
+    {
+        return 1;
+    }
+    a_info_print(&info);
+    sim_dvp_reset();
+    max = 0;
+    total = 0;
+    (void)ov2640_get_bus_stats(&gs_handle, &prev);
+    stats = prev;
+    for (i = 0; i < count; i++)
+    {
+        if (sim_dvp_capture(gs_buf, FRAME_BUFFER_SIZE, &len, &timestamp) != 0)
+        {
+            return 1;
+        }
+        if (a_control_step(i) != 0)
+        {
+            return 1;
+        }
+        us = stats.time_us;
+        (void)ov2640_get_bus_stats(&gs_handle, &stats);
+        us = stats.time_us - us;
+        if (us > max)
+        {
+            max = us;
+        }
+        total += us;
+    }
+    printf("ov2640: %u frames, %u reads, %u writes, %u bank switches, %u bytes, %u failures.\n", (unsigned)count,
+           (unsigned)(stats.reads - prev.reads), (unsigned)(stats.writes - prev.writes),
+           (unsigned)(stats.bank_switches - prev.bank_switches), (unsigned)(stats.bytes - prev.bytes),
+           (unsigned)(stats.failures - prev.failures));
+    printf("ov2640: control loop mean %u us, max %u us, %.2f%% of the %u us frame interval at max.\n",
+           (unsigned)(total / count), (unsigned)max, (double)max * 100.0 / info.frame_us, (unsigned)info.frame_us);
+    
+    return 0;
+}
+
+/**
+ * @brief     check one condition
+ * @param[in] ok condition
+ * @param[in] *name pointer to a check name
+ * @return    status code
+ *            - 0 success
+ *            - 1 check failed
+ * @note      none
+ */
+static uint8_t a_check(uint8_t ok, const char *name)
+{
+    printf("ov2640: check %s %s.\n", name, (ok != 0) ? "ok" : "error");
+    
+    return (ok != 0) ? 0 : 1;
+}
+
+/**
+ * @brief  run the check command
+ * @return status code
+ *         - 0 success
+ *         - 1 check failed
+ * @note   every format is captured with the color bar test at 160x120 and checked against the bar colors
+ */
+static uint8_t a_check_run(void)
+{
+    sim_dvp_info_t info;
+    uint8_t res;
+    uint32_t len;
+    uint32_t pclk;
+    uint32_t i;
+    uint16_t max;
+    uint64_t timestamp;
+    uint64_t prev;
+    ov2640_bus_stats_t prev_stats;
+    ov2640_bus_stats_t stats;
+    sim_bus_stats_t sim_stats;
+    
+    res = 0;
+    if ((a_size_set(160, 120) != 0) || (ov2640_set_color_bar_test(&gs_handle, OV2640_BOOL_TRUE) != 0))
+    {
+        return 1;
+    }
+    
+    /* rgb565 white bar, red bar and the byte swap */
+    (void)a_format_set(SIM_DVP_FORMAT_RGB565);
+    (void)ov2640_set_byte_swap(&gs_handle, OV2640_BYTE_SWAP_YUYV);
+    res |= a_check((sim_dvp_capture(gs_buf, FRAME_BUFFER_SIZE, &len, &timestamp) == 0) && (len == 160 * 120 * 2), "rgb565 size");
+    res |= a_check((gs_buf[0] == 0xFF) && (gs_buf[1] == 0xFF), "rgb565 white");
+    res |= a_check((gs_buf[100 * 2] == 0xF8) && (gs_buf[100 * 2 + 1] == 0x00), "rgb565 red");
+    (void)ov2640_set_byte_swap(&gs_handle, OV2640_BYTE_SWAP_UVUV);
+    (void)sim_dvp_capture(gs_buf, FRAME_BUFFER_SIZE, &len, &timestamp);
+    res |= a_check((gs_buf[100 * 2] == 0x00) && (gs_buf[100 * 2 + 1] == 0xF8), "rgb565 byte swap");
+    
+    /* yuv422 order */
+    (void)a_format_set(SIM_DVP_FORMAT_YUV422);
+    (void)ov2640_set_byte_swap(&gs_handle, OV2640_BYTE_SWAP_YUYV);
+    (void)sim_dvp_capture(gs_buf, FRAME_BUFFER_SIZE, &len, &timestamp);
+    res |= a_check((len == 160 * 120 * 2) && (gs_buf[0] == 0xFF) && (gs_buf[1] == 0x80) && (gs_buf[3] == 0x80), "yuv422 yuyv");
+    (void)ov2640_set_byte_swap(&gs_handle, OV2640_BYTE_SWAP_UVUV);
+    (void)sim_dvp_capture(gs_buf, FRAME_BUFFER_SIZE, &len, &timestamp);
+    res |= a_check((gs_buf[0] == 0x80) && (gs_buf[1] == 0xFF) && (gs_buf[2] == 0x80), "yuv422 uyvy");
+    (void)ov2640_set_byte_swap(&gs_handle, OV2640_BYTE_SWAP_YUYV);
+    
+    /* y8 and raw10 */
+    (void)a_format_set(SIM_DVP_FORMAT_Y8);
+    (void)sim_dvp_capture(gs_buf, FRAME_BUFFER_SIZE, &len, &timestamp);
+    res |= a_check((len == 160 * 120) && (gs_buf[0] == 0xFF) && (gs_buf[159] == 0x00), "y8");
+    (void)a_format_set(SIM_DVP_FORMAT_RAW10);
+    (void)sim_dvp_capture(gs_buf, FRAME_BUFFER_SIZE, &len, &timestamp);
+    max = 0;
+    for (i = 0; i < len; i += 2)
+    {
+        if ((uint16_t)(gs_buf[i] | (gs_buf[i + 1] << 8)) > max)
+        {
+            max = (uint16_t)(gs_buf[i] | (gs_buf[i + 1] << 8));
+        }
+    }
+    res |= a_check((len == 160 * 120 * 2) && (max == 0x3FC), "raw10");
+    
+    /* jpeg markers and size */
+    (void)a_format_set(SIM_DVP_FORMAT_JPEG);
+    (void)sim_dvp_get_info(&info);
+    (void)sim_dvp_capture(gs_buf, FRAME_BUFFER_SIZE, &len, &timestamp);
+    res |= a_check((len <= info.frame_size) && (gs_buf[0] == 0xFF) && (gs_buf[1] == 0xD8) &&
+                   (gs_buf[len - 2] == 0xFF) && (gs_buf[len - 1] == 0xD9), "jpeg markers");
+    res |= a_check((gs_buf[20] == 0xFF) && (gs_buf[21] == 0xC0) && (((gs_buf[25] << 8) | gs_buf[26]) == 120) &&
+                   (((gs_buf[27] << 8) | gs_buf[28]) == 160), "jpeg size");
+    
+    /* frame time follows the clock divider */
+    (void)a_format_set(SIM_DVP_FORMAT_RGB565);
+    (void)sim_dvp_get_info(&info);
+    pclk = info.pclk_hz;
+    prev = timestamp;
+    (void)sim_dvp_capture(gs_buf, FRAME_BUFFER_SIZE, &len, &timestamp);
+    res |= a_check(timestamp - prev == info.frame_us, "frame time");
+    (void)ov2640_set_clock_divider(&gs_handle, 1);
+    (void)sim_dvp_get_info(&info);
+    res |= a_check(info.pclk_hz * 2 == pclk, "clock divider");
+    (void)ov2640_set_clock_divider(&gs_handle, 0);
+    (void)ov2640_set_color_bar_test(&gs_handle, OV2640_BOOL_FALSE);
+    
+    /* bus stats follow the simulated bus */
+    (void)ov2640_get_bus_stats(&gs_handle, &prev_stats);
+    sim_bus_clear_stats();
+    (void)a_control_step(0);
+    (void)ov2640_get_bus_stats(&gs_handle, &stats);
+    sim_bus_get_stats(&sim_stats);
+    res |= a_check((stats.reads - prev_stats.reads == sim_stats.read) && (stats.writes - prev_stats.writes == sim_stats.write) &&
+                   (stats.bytes - prev_stats.bytes == sim_stats.bytes) &&
+                   (stats.bank_switches - prev_stats.bank_switches == sim_stats.bank_switch) &&
+                   (stats.time_us - prev_stats.time_us == sim_stats.time_us - sim_stats.wait_us), "bus stats");
+    
+    printf("ov2640: check frame result %s.\n", (res == 0) ? "ok" : "error");
+    
+    return res;
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      "info [width height]" prints the frame information of every format,
+ *            "dump <format> <count> <file>" writes frames to a file,
+ *            "stream <format> <count>" hands over frames at the modelled rate,
+ *            "budget <format> <count>" runs a control loop per frame and prints its bus time, "check" checks the frames
+ */
+int main(int argc, char **argv)
+{
+    uint8_t res;
+    uint8_t format;
+    
+    if (a_init() != 0)
+    {
+        return 1;
+    }
+    res = 1;
+    format = FRAME_FORMAT_MAX;
+    if ((argc >= 3) && ((strcmp(argv[1], "dump") == 0) || (strcmp(argv[1], "stream") == 0) || (strcmp(argv[1], "budget") == 0)))
+    {
+        format = a_format_parse(argv[2]);
+    }
+    if ((argc < 2) || (strcmp(argv[1], "check") == 0))
+    {
+        res = a_check_run();
+    }
+    else if ((strcmp(argv[1], "info") == 0) && (argc == 2))
+    {
+        res = a_info_run(800, 600);
+    }
+    else if ((strcmp(argv[1], "info") == 0) && (argc == 4))
+    {
+        res = a_info_run((uint16_t)strtoul(argv[2], NULL, 0), (uint16_t)strtoul(argv[3], NULL, 0));
+    }
+    else if ((strcmp(argv[1], "dump") == 0) && (argc == 5) && (format < FRAME_FORMAT_MAX))
+    {
+        res = a_dump_run((sim_dvp_format_t)format, (uint32_t)strtoul(argv[3], NULL, 0), argv[4]);
+    }
+    else if ((strcmp(argv[1], "stream") == 0) && (argc == 4) && (format < FRAME_FORMAT_MAX))
+    {
+        res = a_stream_run((sim_dvp_format_t)format, (uint32_t)strtoul(argv[3], NULL, 0));
+    }
+    else if ((strcmp(argv[1], "budget") == 0) && (argc == 4) && (format < FRAME_FORMAT_MAX))
+    {
+        res = a_budget_run((sim_dvp_format_t)format, (uint32_t)strtoul(argv[3], NULL, 0));
+    }
+    else
+    {
+        printf("ov2640: usage ov2640_frame [info [width height] | dump <format> <count> <file> | "
+               "stream <format> <count> | budget <format> <count> | check].\n");
+        printf("ov2640: format is yuv422, raw10, rgb565, y8 or jpeg.\n");
+    }
+    (void)ov2640_deinit(&gs_handle);
+    
+    return res;
+}
@@ -0,0 +1,829 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      script.c
+ * @brief     script tool source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-16
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/16  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ov2640_interface.h"
+#include "sim_bus.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief script tool definition
+ * @note  the header and the opcodes are the OV2640_SCRIPT_* and OV2640_CODE_* definitions in driver_ov2640.h
+ */
+#define SCRIPT_CODE_COUNT_MAX    64          /**< max registers in one opcode */
+#define SCRIPT_SIZE_MAX          4096        /**< max script size */
+#define SCRIPT_OP_MAX            2048        /**< max script operations */
+#define SCRIPT_TEXT_MAX          65536       /**< max text size */
+
+/**
+ * @brief script operation enumeration definition
+ */
+typedef enum
+{
+    SCRIPT_OP_BANK  = 0x00,        /**< select the bank */
+    SCRIPT_OP_WRITE = 0x01,        /**< write a register */
+    SCRIPT_OP_MASK  = 0x02,        /**< write the masked bits of a register */
+    SCRIPT_OP_DELAY = 0x03,        /**< delay in ms */
+} script_op_type_t;
+
+/**
+ * @brief script operation structure definition
+ */
+typedef struct script_op_s
+{
+    uint8_t type;         /**< operation type */
+    uint8_t bank;         /**< register bank */
+    uint8_t reg;          /**< register address */
+    uint8_t mask;         /**< written bits */
+    uint8_t value;        /**< register value or delay in ms */
+} script_op_t;
+
+/**
+ * @brief sample script definition
+ * @note  covers every opcode, a soft reset, the indirect ports and more writes than one driver batch
+ */
+static const char gsc_sample[] =
+    "# site tuning sample\n"
+    "bank sensor\n"
+    "write 0x12 0x80          # soft reset\n"
+    "delay 5\n"
+    "bank dsp\n"
+    "write 0x05 0x01          # bypass the dsp\n"
+    "bank sensor\n"
+    "write 0x11 0x01          # clock\n"
+    "write 0x03 0x0F\n"
+    "write 0x17 0x11          # window\n"
+    "write 0x18 0x75\n"
+    "write 0x19 0x01\n"
+    "write 0x1A 0x97\n"
+    "write 0x2D 0x00\n"
+    "write 0x2E 0x00\n"
+    "write 0x2F 0x00\n"
+    "write 0x32 0x36\n"
+    "mask 0x04 0xC0 0x80      # mirror off, flip on\n"
+    "mask 0x04 0x08 0x08\n"
+    "bank dsp\n"
+    "write 0x7C 0x00          # sde indirect registers\n"
+    "write 0x7D 0x04\n"
+    "write 0x7C 0x07\n"
+    "write 0x7D 0x20\n"
+    "write 0x7D 0x28\n"
+    "write 0x7D 0x0C\n"
+    "write 0x7D 0x06\n"
+    "write 0xC0 0xC8          # image size\n"
+    "write 0xC1 0x96\n"
+    "write 0x8C 0x00\n"
+    "write 0x86 0x3D\n"
+    "write 0x50 0x00\n"
+    "write 0x51 0x90\n"
+    "write 0x52 0x2C\n"
+    "write 0x53 0x00\n"
+    "write 0x54 0x00\n"
+    "write 0x55 0x88\n"
+    "write 0x57 0x00\n"
+    "write 0x5A 0x50\n"
+    "write 0x5B 0x3C\n"
+    "write 0x5C 0x00\n"
+    "write 0xD3 0x04\n"
+    "write 0x44 0x0C\n"
+    "write 0x5A 0x28          # rewritten register\n"
+    "write 0xE0 0x00\n"
+    "mask 0xDA 0x01 0x00\n"
+    "delay 1\n"
+    "write 0x05 0x00          # enable the dsp\n";
+
+/**
+ * @brief global var definition
+ */
+static ov2640_handle_t gs_handle;                    /**< ov2640 handle */
+
+/**
+ * @brief      parse a number
+ * @param[in]  *s pointer to a token
+ * @param[out] *value pointer to a value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 parse failed
+ * @note       decimal or 0x hex, the value must fit into one byte
+ */
+static uint8_t a_number(const char *s, uint8_t *value)
+{
+    char *end;
+    long v;
+    
+    if (s == NULL)
+    {
+        return 1;
+    }
+    v = strtol(s, &end, 0);
+    if ((*end != '\0') || (v < 0) || (v > 0xFF))
+    {
+        return 1;
+    }
+    *value = (uint8_t)v;
+    
+    return 0;
+}
+
+/**
+ * @brief      parse a text script
+ * @param[in]  *text pointer to a text script
+ * @param[out] *ops pointer to an operation buffer
+ * @param[out] *count pointer to an operation count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 parse failed
+ * @note       one operation per line, "#" starts a comment:
+ *             bank dsp | sensor, write reg value, mask reg mask value, delay ms
+ */
+static uint8_t a_parse(const char *text, script_op_t *ops, uint16_t *count)
+{
+    char line[256];
+    char *tok[5];
+    char *p;
+    uint8_t bank;
+    uint16_t n;
+    uint16_t no;
+    uint16_t i;
+    script_op_t op;
+    
+    bank = 0xFF;
+    *count = 0;
+    no = 0;
+    while (*text != '\0')
+    {
+        for (i = 0; (text[i] != '\0') && (text[i] != '\n') && (i < sizeof(line) - 1); i++)
+        {
+            line[i] = text[i];
+        }
+        line[i] = '\0';
+        text += i;
+        if (*text == '\n')
+        {
+            text++;
+        }
+        no++;
+        p = strchr(line, '#');
+        if (p != NULL)
+        {
+            *p = '\0';
+        }
+        n = 0;
+        for (p = strtok(line, " \t\r"); (p != NULL) && (n < 5); p = strtok(NULL, " \t\r"))
+        {
+            tok[n++] = p;
+        }
+        if (n == 0)
+        {
+            continue;
+        }
+        memset(&op, 0, sizeof(op));
+        if ((strcmp(tok[0], "bank") == 0) && (n == 2) &&
+            ((strcmp(tok[1], "dsp") == 0) || (strcmp(tok[1], "sensor") == 0)))
+        {
+            op.type = SCRIPT_OP_BANK;
+            op.bank = (strcmp(tok[1], "sensor") == 0) ? OV2640_BANK_SENSOR : OV2640_BANK_DSP;
+            bank = op.bank;
+        }
+        else if ((strcmp(tok[0], "write") == 0) && (n == 3) && (bank != 0xFF) &&
+                 (a_number(tok[1], &op.reg) == 0) && (a_number(tok[2], &op.value) == 0) && (op.reg != 0xFF))
+        {
+            op.type = SCRIPT_OP_WRITE;
+            op.bank = bank;
+            op.mask = 0xFF;
+        }
+        else if ((strcmp(tok[0], "mask") == 0) && (n == 4) && (bank != 0xFF) && (a_number(tok[1], &op.reg) == 0) &&
+                 (a_number(tok[2], &op.mask) == 0) && (a_number(tok[3], &op.value) == 0) && (op.reg != 0xFF))
+        {
+            op.type = SCRIPT_OP_MASK;
+            op.bank = bank;
+        }
+        else if ((strcmp(tok[0], "delay") == 0) && (n == 2) && (a_number(tok[1], &op.value) == 0))
+        {
+            op.type = SCRIPT_OP_DELAY;
+            op.bank = bank;
+        }
+        else
+        {
+            printf("ov2640: line %d is invalid.\n", no);
+            
+            return 1;
+        }
+        if (*count >= SCRIPT_OP_MAX)
+        {
+            printf("ov2640: script is too long.\n");
+            
+            return 1;
+        }
+        ops[(*count)++] = op;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     contiguous write length
+ * @param[in] *ops pointer to an operation buffer
+ * @param[in] len operation count
+ * @param[in] i first operation
+ * @return    run length
+ * @note      the run stops at the first operation that is not a write
+ */
+static uint16_t a_run_length(const script_op_t *ops, uint16_t len, uint16_t i)
+{
+    uint16_t n;
+    
+    n = 1;
+    while ((i + n < len) && (n < SCRIPT_CODE_COUNT_MAX) && (ops[i + n].type == SCRIPT_OP_WRITE) &&
+           (ops[i + n].reg == ops[i].reg + n))
+    {
+        n++;
+    }
+    
+    return n;
+}
+
+/**
+ * @brief     same value length
+ * @param[in] *ops pointer to an operation buffer
+ * @param[in] i first operation
+ * @param[in] n run length
+ * @return    length of the same value prefix
+ * @note      none
+ */
+static uint16_t a_fill_length(const script_op_t *ops, uint16_t i, uint16_t n)
+{
+    uint16_t m;
+    
+    m = 1;
+    while ((m < n) && (ops[i + m].value == ops[i].value))
+    {
+        m++;
+    }
+    
+    return m;
+}
+
+/**
+ * @brief      compile the operations
+ * @param[in]  *ops pointer to an operation buffer
+ * @param[in]  len operation count
+ * @param[out] *buf pointer to a script buffer
+ * @return     script length, 0 if the script is too long
+ * @note       the writes are encoded like the driver tables, the header gets the body length and crc
+ */
+static uint16_t a_compile(const script_op_t *ops, uint16_t len, uint8_t *buf)
+{
+    uint8_t j;
+    uint16_t crc;
+    uint16_t i;
+    uint16_t k;
+    uint16_t n;
+    uint16_t m;
+    uint16_t p;
+    
+    p = OV2640_SCRIPT_HEADER_SIZE;
+    i = 0;
+    while (i < len)
+    {
+        if (p + 2 * SCRIPT_CODE_COUNT_MAX + 1 > SCRIPT_SIZE_MAX)
+        {
+            return 0;
+        }
+        if (ops[i].type == SCRIPT_OP_BANK)
+        {
+            buf[p++] = OV2640_CODE_BANK | ops[i].bank;
+            i++;
+            
+            continue;
+        }
+        if (ops[i].type == SCRIPT_OP_DELAY)
+        {
+            buf[p++] = OV2640_CODE_DELAY;
+            buf[p++] = ops[i].value;
+            i++;
+            
+            continue;
+        }
+        if (ops[i].type == SCRIPT_OP_MASK)
+        {
+            buf[p++] = OV2640_CODE_MASK;
+            buf[p++] = ops[i].reg;
+            buf[p++] = ops[i].mask;
+            buf[p++] = ops[i].value;
+            i++;
+            
+            continue;
+        }
+        n = a_run_length(ops, len, i);
+        m = a_fill_length(ops, i, n);
+        if (m >= 2)
+        {
+            buf[p++] = OV2640_CODE_FILL | (m - 1);
+            buf[p++] = ops[i].reg;
+            buf[p++] = ops[i].value;
+            i += m;
+            
+            continue;
+        }
+        if (n >= 3)
+        {
+            buf[p++] = OV2640_CODE_RUN | (n - 1);
+            buf[p++] = ops[i].reg;
+            for (k = 0; k < n; k++)
+            {
+                buf[p++] = ops[i + k].value;
+            }
+            i += n;
+            
+            continue;
+        }
+        
+        /* scattered registers */
+        k = 0;
+        while ((i + k < len) && (k < SCRIPT_CODE_COUNT_MAX) && (ops[i + k].type == SCRIPT_OP_WRITE))
+        {
+            n = a_run_length(ops, len, i + k);
+            if ((n >= 3) || (a_fill_length(ops, i + k, n) >= 2))
+            {
+                break;
+            }
+            k++;
+        }
+        buf[p++] = OV2640_CODE_PAIR | (k - 1);
+        for (n = 0; n < k; n++)
+        {
+            buf[p++] = ops[i + n].reg;
+            buf[p++] = ops[i + n].value;
+        }
+        i += k;
+    }
+    
+    crc = 0xFFFF;
+    for (k = OV2640_SCRIPT_HEADER_SIZE; k < p; k++)
+    {
+        crc ^= (uint16_t)buf[k] << 8;
+        for (j = 0; j < 8; j++)
+        {
+            crc = ((crc & 0x8000) != 0) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+        }
+    }
+    buf[0] = OV2640_SCRIPT_MAGIC0;
+    buf[1] = OV2640_SCRIPT_MAGIC1;
+    buf[2] = OV2640_SCRIPT_VERSION;
+    buf[3] = 0;
+    buf[4] = (uint8_t)((p - OV2640_SCRIPT_HEADER_SIZE) >> 8);
+    buf[5] = (uint8_t)((p - OV2640_SCRIPT_HEADER_SIZE) >> 0);
+    buf[6] = (uint8_t)(crc >> 8);
+    buf[7] = (uint8_t)(crc >> 0);
+    
+    return p;
+}
+
+/**
+ * @brief      decompile a script
+ * @param[in]  *buf pointer to a script buffer
+ * @param[in]  len script length
+ * @param[out] *text pointer to a text buffer
+ * @param[in]  size text buffer size
+ * @return     status code
+ *             - 0 success
+ *             - 1 decompile failed
+ * @note       the crc is not checked, ov2640_load_script checks it on the target
+ */
+static uint8_t a_decompile(const uint8_t *buf, uint16_t len, char *text, uint32_t size)
+{
+    uint8_t op;
+    uint16_t i;
+    uint16_t j;
+    uint16_t n;
+    uint16_t end;
+    uint32_t p;
+    
+    if ((len < OV2640_SCRIPT_HEADER_SIZE) || (buf[0] != OV2640_SCRIPT_MAGIC0) || (buf[1] != OV2640_SCRIPT_MAGIC1) ||
+        (buf[2] != OV2640_SCRIPT_VERSION))
+    {
+        return 1;
+    }
+    end = OV2640_SCRIPT_HEADER_SIZE + (uint16_t)((buf[4] << 8) | buf[5]);
+    if (end > len)
+    {
+        return 1;
+    }
+    p = 0;
+    i = OV2640_SCRIPT_HEADER_SIZE;
+    while ((i < end) && (p + 32 * SCRIPT_CODE_COUNT_MAX < size))
+    {
+        op = buf[i++];
+        if (op == OV2640_CODE_END)
+        {
+            break;
+        }
+        if ((op & 0xFE) == OV2640_CODE_BANK)
+        {
+            p += sprintf(text + p, "bank %s\n", (op & 0x01) != 0 ? "sensor" : "dsp");
+            
+            continue;
+        }
+        if ((op == OV2640_CODE_DELAY) && (i + 1 <= end))
+        {
+            p += sprintf(text + p, "delay %d\n", buf[i]);
+            i += 1;
+            
+            continue;
+        }
+        if ((op == OV2640_CODE_MASK) && (i + 3 <= end))
+        {
+            p += sprintf(text + p, "mask 0x%02X 0x%02X 0x%02X\n", buf[i], buf[i + 1], buf[i + 2]);
+            i += 3;
+            
+            continue;
+        }
+        n = (op & 0x3F) + 1;
+        if ((op < OV2640_CODE_FILL) ||
+            (i + (((op & 0xC0) == OV2640_CODE_PAIR) ? (2 * n) : (((op & 0xC0) == OV2640_CODE_RUN) ? (n + 1) : 2)) > end))
+        {
+            return 1;
+        }
+        for (j = 0; j < n; j++)
+        {
+            if ((op & 0xC0) == OV2640_CODE_PAIR)
+            {
+                p += sprintf(text + p, "write 0x%02X 0x%02X\n", buf[i + 2 * j], buf[i + 2 * j + 1]);
+            }
+            else
+            {
+                p += sprintf(text + p, "write 0x%02X 0x%02X\n", (uint8_t)(buf[i] + j),
+                             ((op & 0xC0) == OV2640_CODE_RUN) ? buf[i + 1 + j] : buf[i + 1]);
+            }
+        }
+        i += ((op & 0xC0) == OV2640_CODE_PAIR) ? (2 * n) : (((op & 0xC0) == OV2640_CODE_RUN) ? (n + 1) : 2);
+    }
+    if (i < end)
+    {
+        return 1;
+    }
+    text[p] = '\0';
+    
+    return 0;
+}
+
+/**
+ * @brief  driver init
+ * @return status code
+ *         - 0 success
+ *         - 1 init failed
+ * @note   the simulated bus is reset by the init
+ */
+static uint8_t a_init(void)
+{
+    DRIVER_OV2640_LINK_INIT(&gs_handle, ov2640_handle_t);
+    DRIVER_OV2640_LINK_SCCB_INIT(&gs_handle, ov2640_interface_sccb_init);
+    DRIVER_OV2640_LINK_SCCB_DEINIT(&gs_handle, ov2640_interface_sccb_deinit);
+    DRIVER_OV2640_LINK_SCCB_READ(&gs_handle, ov2640_interface_sccb_read);
+    DRIVER_OV2640_LINK_SCCB_WRITE(&gs_handle, ov2640_interface_sccb_write);
+    DRIVER_OV2640_LINK_POWER_DOWN_INIT(&gs_handle, ov2640_interface_power_down_init);
+    DRIVER_OV2640_LINK_POWER_DOWN_DEINIT(&gs_handle, ov2640_interface_power_down_deinit);
+    DRIVER_OV2640_LINK_POWER_DOWN_WRITE(&gs_handle, ov2640_interface_power_down_write);
+    DRIVER_OV2640_LINK_RESET_INIT(&gs_handle, ov2640_interface_reset_init);
+    DRIVER_OV2640_LINK_RESET_DEINIT(&gs_handle, ov2640_interface_reset_deinit);
+    DRIVER_OV2640_LINK_RESET_WRITE(&gs_handle, ov2640_interface_reset_write);
+    DRIVER_OV2640_LINK_DELAY_MS(&gs_handle, ov2640_interface_delay_ms);
+    DRIVER_OV2640_LINK_DEBUG_PRINT(&gs_handle, ov2640_interface_debug_print);
+    if (ov2640_init(&gs_handle) != 0)
+    {
+        ov2640_interface_debug_print("ov2640: init failed.\n");
+        
+        return 1;
+    }
+    
+    return ov2640_set_burst_write(&gs_handle, OV2640_BOOL_TRUE);
+}
+
+/**
+ * @brief      run a script on the simulated bus
+ * @param[in]  *ops pointer to an operation buffer, NULL loads the script
+ * @param[in]  len operation count
+ * @param[in]  *buf pointer to a script buffer
+ * @param[in]  size script length
+ * @param[out] *stats pointer to a statistics structure
+ * @param[out] **image pointer to a register image buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 run failed
+ * @note       the operations are replayed one register at a time with the register setters
+ */
+static uint8_t a_run(const script_op_t *ops, uint16_t len, const uint8_t *buf, uint16_t size,
+                     sim_bus_stats_t *stats, uint8_t image[2][256])
+{
+    uint8_t res;
+    uint8_t data;
+    uint16_t i;
+    uint16_t r;
+    
+    if (a_init() != 0)
+    {
+        return 1;
+    }
+    res = 0;
+    sim_bus_clear_stats();
+    if (ops != NULL)
+    {
+        for (i = 0; i < len; i++)
+        {
+            if (ops[i].type == SCRIPT_OP_DELAY)
+            {
+                ov2640_interface_delay_ms(ops[i].value);
+            }
+            else if (ops[i].type != SCRIPT_OP_BANK)
+            {
+                data = 0;
+                if (ops[i].mask != 0xFF)
+                {
+                    res |= (ops[i].bank == OV2640_BANK_SENSOR) ? ov2640_get_sensor_reg(&gs_handle, ops[i].reg, &data) :
+                                                                 ov2640_get_dsp_reg(&gs_handle, ops[i].reg, &data);
+                }
+                data = (data & (~ops[i].mask)) | (ops[i].value & ops[i].mask);
+                res |= (ops[i].bank == OV2640_BANK_SENSOR) ? ov2640_set_sensor_reg(&gs_handle, ops[i].reg, data) :
+                                                             ov2640_set_dsp_reg(&gs_handle, ops[i].reg, data);
+            }
+            else
+            {
+                /* the setters select the bank */
+            }
+        }
+    }
+    else
+    {
+        res = ov2640_load_script(&gs_handle, buf, size);
+    }
+    sim_bus_get_stats(stats);
+    for (r = 0; r < 256; r++)
+    {
+        image[0][r] = sim_bus_peek(0, (uint8_t)r);
+        image[1][r] = sim_bus_peek(1, (uint8_t)r);
+    }
+    (void)ov2640_deinit(&gs_handle);
+    
+    return res;
+}
+
+/**
+ * @brief      read a file
+ * @param[in]  *name pointer to a file name
+ * @param[out] *buf pointer to a buffer
+ * @param[in]  size buffer size
+ * @param[out] *len pointer to a length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+static uint8_t a_file_read(const char *name, uint8_t *buf, uint32_t size, uint32_t *len)
+{
+    FILE *f;
+    
+    f = fopen(name, "rb");
+    if (f == NULL)
+    {
+        printf("ov2640: can't open %s.\n", name);
+        
+        return 1;
+    }
+    *len = (uint32_t)fread(buf, 1, size, f);
+    if (!feof(f))
+    {
+        printf("ov2640: %s is too long.\n", name);
+        (void)fclose(f);
+        
+        return 1;
+    }
+    (void)fclose(f);
+    
+    return 0;
+}
+
+/**
+ * @brief     compile a text script file
+ * @param[in] *in pointer to a text file name
+ * @param[in] *out pointer to a script file name
+ * @return    status code
+ *            - 0 success
+ *            - 1 compile failed
+ * @note      none
+ */
+static uint8_t a_compile_run(const char *in, const char *out)
+{
+    FILE *f;
+    uint16_t count;
+    uint16_t len;
+    uint32_t size;
+    static char text[SCRIPT_TEXT_MAX + 1];
+    static script_op_t ops[SCRIPT_OP_MAX];
+    static uint8_t buf[SCRIPT_SIZE_MAX];
+    
+    if (a_file_read(in, (uint8_t *)text, SCRIPT_TEXT_MAX, &size) != 0)
+    {
+        return 1;
+    }
+    text[size] = '\0';
+    if (a_parse(text, ops, &count) != 0)
+    {
+        return 1;
+    }
+    len = a_compile(ops, count, buf);
+    if (len == 0)
+    {
+        printf("ov2640: script is too long.\n");
+        
+        return 1;
+    }
+    f = fopen(out, "wb");
+    if ((f == NULL) || (fwrite(buf, 1, len, f) != len))
+    {
+        printf("ov2640: can't write %s.\n", out);
+        if (f != NULL)
+        {
+            (void)fclose(f);
+        }
+        
+        return 1;
+    }
+    (void)fclose(f);
+    printf("ov2640: %d operations, %d bytes, crc 0x%02X%02X.\n", count, len, buf[6], buf[7]);
+    
+    return 0;
+}
+
+/**
+ * @brief     print a script file as text
+ * @param[in] *in pointer to a script file name
+ * @return    status code
+ *            - 0 success
+ *            - 1 dump failed
+ * @note      none
+ */
+static uint8_t a_dump_run(const char *in)
+{
+    uint32_t size;
+    static uint8_t buf[SCRIPT_SIZE_MAX];
+    static char text[SCRIPT_TEXT_MAX];
+    
+    if (a_file_read(in, buf, SCRIPT_SIZE_MAX, &size) != 0)
+    {
+        return 1;
+    }
+    if (a_decompile(buf, (uint16_t)size, text, SCRIPT_TEXT_MAX) != 0)
+    {
+        printf("ov2640: %s is invalid.\n", in);
+        
+        return 1;
+    }
+    printf("%s", text);
+    
+    return 0;
+}
+
+/**
+ * @brief  round trip check
+ * @return status code
+ *         - 0 success
+ *         - 1 check failed
+ * @note   the sample is compiled, decompiled and compiled again, the script must not change,
+ *         ov2640_load_script must leave the register image of the replayed text,
+ *         and damaged headers and bodies must be rejected before any write
+ */
+static uint8_t a_check_run(void)
+{
+    uint8_t ok;
+    uint8_t res[4];
+    uint16_t count;
+    uint16_t count_check;
+    uint16_t len;
+    uint16_t len_check;
+    static char text[SCRIPT_TEXT_MAX];
+    static script_op_t ops[SCRIPT_OP_MAX];
+    static script_op_t ops_check[SCRIPT_OP_MAX];
+    static uint8_t buf[SCRIPT_SIZE_MAX];
+    static uint8_t buf_check[SCRIPT_SIZE_MAX];
+    static uint8_t image[2][256];
+    static uint8_t image_check[2][256];
+    sim_bus_stats_t stats;
+    sim_bus_stats_t stats_check;
+    
+    /* round trip */
+    if ((a_parse(gsc_sample, ops, &count) != 0) || ((len = a_compile(ops, count, buf)) == 0))
+    {
+        return 1;
+    }
+    if ((a_decompile(buf, len, text, SCRIPT_TEXT_MAX) != 0) || (a_parse(text, ops_check, &count_check) != 0))
+    {
+        return 1;
+    }
+    len_check = a_compile(ops_check, count_check, buf_check);
+    ok = (len == len_check) && (memcmp(buf, buf_check, len) == 0);
+    printf("ov2640: sample %d operations, %d bytes, round trip %s.\n", count, len, ok ? "ok" : "error");
+    
+    /* load */
+    if (a_run(ops, count, NULL, 0, &stats, image) != 0)
+    {
+        return 1;
+    }
+    if (a_run(NULL, 0, buf, len, &stats_check, image_check) != 0)
+    {
+        return 1;
+    }
+    ok = ok && (memcmp(image, image_check, sizeof(image)) == 0);
+    printf("ov2640: setters %d transactions %d us, script %d transactions %d us.\n",
+           (int)(stats.read + stats.write), (int)stats.time_us,
+           (int)(stats_check.read + stats_check.write), (int)stats_check.time_us);
+    
+    /* damaged scripts */
+    if (a_init() != 0)
+    {
+        return 1;
+    }
+    sim_bus_clear_stats();
+    buf[0] ^= 0xFF;
+    res[0] = ov2640_load_script(&gs_handle, buf, len);
+    buf[0] ^= 0xFF;
+    buf[2] ^= 0xFF;
+    res[1] = ov2640_load_script(&gs_handle, buf, len);
+    buf[2] ^= 0xFF;
+    buf[len - 1] ^= 0x01;
+    res[2] = ov2640_load_script(&gs_handle, buf, len);
+    buf[len - 1] ^= 0x01;
+    res[3] = ov2640_load_script(&gs_handle, buf, len - 1);
+    sim_bus_get_stats(&stats);
+    (void)ov2640_deinit(&gs_handle);
+    printf("ov2640: damaged magic %d, version %d, crc %d, length %d, %d writes.\n",
+           res[0], res[1], res[2], res[3], (int)stats.write);
+    ok = ok && (res[0] == 4) && (res[1] == 5) && (res[2] == 6) && (res[3] == 4) && (stats.write == 0);
+    printf("ov2640: check script result %s.\n", ok ? "ok" : "error");
+    
+    return ok ? 0 : 1;
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      run "compile <text> <script>" to compile a text script, "dump <script>" to print a script as text
+ *            or "check" to run the round trip check
+ */
+int main(int argc, char **argv)
+{
+    if ((argc >= 4) && (strcmp(argv[1], "compile") == 0))
+    {
+        return a_compile_run(argv[2], argv[3]);
+    }
+    if ((argc >= 3) && (strcmp(argv[1], "dump") == 0))
+    {
+        return a_dump_run(argv[2]);
+    }
+    if ((argc >= 2) && (strcmp(argv[1], "sample") == 0))
+    {
+        printf("%s", gsc_sample);
+        
+        return 0;
+    }
+    
+    return a_check_run();
+}
@@ -0,0 +1,1050 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      table.c
+ * @brief     table tool source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-16
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/16  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ov2640_basic.h"
+#include "sim_bus.h"
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * @brief table tool definition
+ * @note  the opcodes are the OV2640_CODE_* definitions in driver_ov2640.h
+ */
+#define TABLE_CODE_COUNT_MAX    64          /**< max registers in one opcode */
+#define TABLE_CODE_SIZE_MAX     1024        /**< max encoded table size */
+#define TABLE_LOG_MAX           1024        /**< max decoded or logged writes */
+
+/**
+ * @brief flat table definition
+ * @note  copied from the flat tables the encoded tables were made from
+ */
+static const uint8_t gsc_init_table[][2] = 
+{
+    {0xFF, 0x00},
+    {0x2C, 0xFF},
+    {0x2E, 0xDF},
+    {0xFF, 0x01},
+    {0x3C, 0x32},
+    {0x11, 0x00},
+    {0x09, 0x02},
+    {0x04, 0xD8},
+    {0x13, 0xE5},
+    {0x14, 0x48},
+    {0x2C, 0x0C},
+    {0x33, 0x78},
+    {0x3A, 0x33},
+    {0x3B, 0xFB},
+    {0x3E, 0x00},
+    {0x43, 0x11},
+    {0x16, 0x10},
+    {0x39, 0x92},
+    {0x35, 0xDA},
+    {0x22, 0x1A},
+    {0x37, 0xC3},
+    {0x23, 0x00},
+    {0x34, 0xC0},
+    {0x36, 0x1A},
+    {0x06, 0x88},
+    {0x07, 0xC0},
+    {0x0D, 0x87},
+    {0x0E, 0x41},
+    {0x4C, 0x00},
+    {0x48, 0x00},
+    {0x5B, 0x00},
+    {0x42, 0x03},
+    {0x4A, 0x81},
+    {0x21, 0x99},
+    {0x24, 0x40},
+    {0x25, 0x38},
+    {0x26, 0x82},
+    {0x5C, 0x00},
+    {0x63, 0x00},
+    {0x46, 0x00},
+    {0x0C, 0x3C},
+    {0x61, 0x70},
+    {0x62, 0x80},
+    {0x7C, 0x05},
+    {0x20, 0x80},
+    {0x28, 0x30},
+    {0x6C, 0x00},
+    {0x6D, 0x80},
+    {0x6E, 0x00},
+    {0x70, 0x02},
+    {0x71, 0x94},
+    {0x73, 0xC1},
+    {0x3D, 0x34},
+    {0x5A, 0x57},
+    {0x12, 0x00},
+    {0x17, 0x11},
+    {0x18, 0x75},
+    {0x19, 0x01},
+    {0x1A, 0x97},
+    {0x32, 0x36},
+    {0x03, 0x0F},
+    {0x37, 0x40},
+    {0x4F, 0xCA},
+    {0x50, 0xA8},
+    {0x5A, 0x23},
+    {0x6D, 0x00},
+    {0x6D, 0x38},
+    {0xFF, 0x00},
+    {0xE5, 0x7F},
+    {0xF9, 0xC0},
+    {0x41, 0x24},
+    {0xE0, 0x14},
+    {0x76, 0xFF},
+    {0x33, 0xA0},
+    {0x42, 0x20},
+    {0x43, 0x18},
+    {0x4C, 0x00},
+    {0x87, 0xD5},
+    {0x88, 0x3F},
+    {0xD7, 0x03},
+    {0xD9, 0x10},
+    {0xD3, 0x82},
+    {0xC8, 0x08},
+    {0xC9, 0x80},
+    {0x7C, 0x00},
+    {0x7D, 0x00},
+    {0x7C, 0x03},
+    {0x7D, 0x48},
+    {0x7D, 0x48},
+    {0x7C, 0x08},
+    {0x7D, 0x20},
+    {0x7D, 0x10},
+    {0x7D, 0x0E},
+    {0x90, 0x00},
+    {0x91, 0x0E},
+    {0x91, 0x1A},
+    {0x91, 0x31},
+    {0x91, 0x5A},
+    {0x91, 0x69},
+    {0x91, 0x75},
+    {0x91, 0x7E},
+    {0x91, 0x88},
+    {0x91, 0x8F},
+    {0x91, 0x96},
+    {0x91, 0xA3},
+    {0x91, 0xAF},
+    {0x91, 0xC4},
+    {0x91, 0xD7},
+    {0x91, 0xE8},
+    {0x91, 0x20},
+    {0x92, 0x00},
+    {0x93, 0x06},
+    {0x93, 0xE3},
+    {0x93, 0x05},
+    {0x93, 0x05},
+    {0x93, 0x00},
+    {0x93, 0x04},
+    {0x93, 0x00},
+    {0x93, 0x00},
+    {0x93, 0x00},
+    {0x93, 0x00},
+    {0x93, 0x00},
+    {0x93, 0x00},
+    {0x93, 0x00},
+    {0x96, 0x00},
+    {0x97, 0x08},
+    {0x97, 0x19},
+    {0x97, 0x02},
+    {0x97, 0x0C},
+    {0x97, 0x24},
+    {0x97, 0x30},
+    {0x97, 0x28},
+    {0x97, 0x26},
+    {0x97, 0x02},
+    {0x97, 0x98},
+    {0x97, 0x80},
+    {0x97, 0x00},
+    {0x97, 0x00},
+    {0xC3, 0xEF},
+    {0xA4, 0x00},
+    {0xA8, 0x00},
+    {0xC5, 0x11},
+    {0xC6, 0x51},
+    {0xBF, 0x80},
+    {0xC7, 0x10},
+    {0xB6, 0x66},
+    {0xB8, 0xA5},
+    {0xB7, 0x64},
+    {0xB9, 0x7C},
+    {0xB3, 0xAF},
+    {0xB4, 0x97},
+    {0xB5, 0xFF},
+    {0xB0, 0xC5},
+    {0xB1, 0x94},
+    {0xB2, 0x0F},
+    {0xC4, 0x5C},
+    {0xC0, 0xC8},
+    {0xC1, 0x96},
+    {0x8C, 0x00},
+    {0x86, 0x3D},
+    {0x50, 0x00},
+    {0x51, 0x90},
+    {0x52, 0x2C},
+    {0x53, 0x00},
+    {0x54, 0x00},
+    {0x55, 0x88},
+    {0x5A, 0x90},
+    {0x5B, 0x2C},
+    {0x5C, 0x05},
+    {0xD3, 0x02},
+    {0xC3, 0xED},
+    {0x7F, 0x00},
+    {0xDA, 0x09},
+    {0xE5, 0x1F},
+    {0xE1, 0x67},
+    {0xE0, 0x00},
+    {0xDD, 0x7F},
+    {0x05, 0x00},
+};
+
+static const uint8_t gsc_jpeg_init_table[][2] = 
+{
+    {0xFF, 0x00},
+    {0xDA, 0x10},
+    {0xD7, 0x03},
+    {0xDF, 0x00},
+    {0x33, 0x80},
+    {0x3C, 0x40},
+    {0xE1, 0x77},
+    {0x00, 0x00},
+    {0xFF, 0x01},
+    {0xE0, 0x14},
+    {0xE1, 0x77},
+    {0xE5, 0x1F},
+    {0xD7, 0x03},
+    {0xDA, 0x10},
+    {0xE0, 0x00},
+};
+
+static const uint8_t gsc_rgb565_init_table[][2] = 
+{
+    {0xFF, 0x00},
+    {0xDA, 0x09},
+    {0xD7, 0x03},
+    {0xDF, 0x02},
+    {0x33, 0xA0},
+    {0x3C, 0x00},
+    {0xE1, 0x67},
+    {0xFF, 0x01},
+    {0xE0, 0x00},
+    {0xE1, 0x00},
+    {0xE5, 0x00},
+    {0xD7, 0x00},
+    {0xDA, 0x00},
+    {0xE0, 0x00},
+};
+
+/**
+ * @brief table write structure definition
+ */
+typedef struct table_write_s
+{
+    uint8_t delay;        /**< 1 for a delay entry */
+    uint8_t bank;         /**< register bank */
+    uint8_t reg;          /**< register address */
+    uint8_t value;        /**< register value or delay in ms */
+} table_write_t;
+
+/**
+ * @brief table item structure definition
+ */
+typedef struct table_item_s
+{
+    const char *name;               /**< table name */
+    const char *brief;              /**< table brief */
+    const uint8_t (*flat)[2];       /**< flat table */
+    uint16_t len;                   /**< flat table length */
+    uint8_t (*load)(ov2640_handle_t *handle);        /**< driver table function */
+} table_item_t;
+
+/**
+ * @brief global var definition
+ */
+static ov2640_handle_t gs_handle;                    /**< ov2640 handle */
+static table_write_t gs_log[TABLE_LOG_MAX];          /**< write log */
+static uint16_t gs_log_len;                          /**< write log length */
+
+/**
+ * @brief table list definition
+ */
+static const table_item_t gsc_table[] =
+{
+    {"init", "init", gsc_init_table, sizeof(gsc_init_table) / 2, ov2640_table_init},
+    {"jpeg_init", "jpeg init", gsc_jpeg_init_table, sizeof(gsc_jpeg_init_table) / 2, ov2640_table_jpeg_init},
+    {"rgb565_init", "rgb565 init", gsc_rgb565_init_table, sizeof(gsc_rgb565_init_table) / 2, ov2640_table_rgb565_init},
+};
+
+/**
+ * @brief      flat table expand
+ * @param[in]  **flat pointer to a flat table
+ * @param[in]  len flat table length
+ * @param[out] *out pointer to a write buffer
+ * @return     write count
+ * @note       ra_dlmt entries select the bank of the following writes
+ */
+static uint16_t a_flat_expand(const uint8_t (*flat)[2], uint16_t len, table_write_t *out)
+{
+    uint8_t bank;
+    uint16_t i;
+    uint16_t n;
+    
+    bank = 0xFF;
+    n = 0;
+    for (i = 0; i < len; i++)
+    {
+        if (flat[i][0] == 0xFF)
+        {
+            bank = flat[i][1] & 0x01;
+            
+            continue;
+        }
+        out[n].delay = 0;
+        out[n].bank = bank;
+        out[n].reg = flat[i][0];
+        out[n].value = flat[i][1];
+        n++;
+    }
+    
+    return n;
+}
+
+/**
+ * @brief     contiguous run length
+ * @param[in] **flat pointer to a flat table
+ * @param[in] len flat table length
+ * @param[in] i first entry
+ * @return    run length
+ * @note      the run stops at ra_dlmt
+ */
+static uint16_t a_run_length(const uint8_t (*flat)[2], uint16_t len, uint16_t i)
+{
+    uint16_t n;
+    
+    n = 1;
+    while ((i + n < len) && (n < TABLE_CODE_COUNT_MAX) &&
+           (flat[i + n][0] != 0xFF) && (flat[i + n][0] == flat[i][0] + n))
+    {
+        n++;
+    }
+    
+    return n;
+}
+
+/**
+ * @brief     same value length
+ * @param[in] **flat pointer to a flat table
+ * @param[in] i first entry
+ * @param[in] n run length
+ * @return    length of the same value prefix
+ * @note      none
+ */
+static uint16_t a_fill_length(const uint8_t (*flat)[2], uint16_t i, uint16_t n)
+{
+    uint16_t m;
+    
+    m = 1;
+    while ((m < n) && (flat[i + m][1] == flat[i][1]))
+    {
+        m++;
+    }
+    
+    return m;
+}
+
+/**
+ * @brief      encode a flat table
+ * @param[in]  **flat pointer to a flat table
+ * @param[in]  len flat table length
+ * @param[out] *code pointer to a code buffer
+ * @param[in]  verbose print the c source
+ * @return     code length
+ * @note       contiguous registers become run or fill opcodes, scattered registers are grouped into pairs,
+ *             the table ends with the buffer so no end opcode is added
+ */
+static uint16_t a_encode(const uint8_t (*flat)[2], uint16_t len, uint8_t *code, uint8_t verbose)
+{
+    uint16_t i;
+    uint16_t j;
+    uint16_t n;
+    uint16_t m;
+    uint16_t p;
+    
+    p = 0;
+    i = 0;
+    while (i < len)
+    {
+        if (flat[i][0] == 0xFF)
+        {
+            code[p++] = OV2640_CODE_BANK | (flat[i][1] & 0x01);
+            if (verbose != 0)
+            {
+                printf("    0x%02X,%*s/* %s bank */\n", code[p - 1], 76, "", (flat[i][1] & 0x01) != 0 ? "sensor" : "dsp");
+            }
+            i++;
+            
+            continue;
+        }
+        n = a_run_length(flat, len, i);
+        m = a_fill_length(flat, i, n);
+        if (m >= 2)
+        {
+            code[p++] = OV2640_CODE_FILL | (m - 1);
+            code[p++] = flat[i][0];
+            code[p++] = flat[i][1];
+            if (verbose != 0)
+            {
+                printf("    0x%02X, 0x%02X, 0x%02X,%*s/* fill %d */\n", code[p - 3], code[p - 2], code[p - 1], 64, "", m);
+            }
+            i += m;
+            
+            continue;
+        }
+        if (n >= 3)
+        {
+            code[p++] = OV2640_CODE_RUN | (n - 1);
+            code[p++] = flat[i][0];
+            if (verbose != 0)
+            {
+                printf("    0x%02X, 0x%02X,", code[p - 2], code[p - 1]);
+            }
+            for (j = 0; j < n; j++)
+            {
+                code[p++] = flat[i + j][1];
+                if (verbose != 0)
+                {
+                    printf(" 0x%02X,", code[p - 1]);
+                }
+            }
+            if (verbose != 0)
+            {
+                printf("%*s/* run %d */\n", (int)(76 - 6 * (n + 1)) > 1 ? (int)(76 - 6 * (n + 1)) : 1, "", n);
+            }
+            i += n;
+            
+            continue;
+        }
+        
+        /* scattered registers */
+        j = 0;
+        while ((i + j < len) && (j < TABLE_CODE_COUNT_MAX) && (flat[i + j][0] != 0xFF))
+        {
+            n = a_run_length(flat, len, i + j);
+            if ((n >= 3) || (a_fill_length(flat, i + j, n) >= 2))
+            {
+                break;
+            }
+            j++;
+        }
+        code[p++] = OV2640_CODE_PAIR | (j - 1);
+        if (verbose != 0)
+        {
+            printf("    0x%02X,%*s/* %d pairs */\n", code[p - 1], 76, "", j);
+        }
+        for (n = 0; n < j; n++)
+        {
+            code[p++] = flat[i + n][0];
+            code[p++] = flat[i + n][1];
+            if (verbose != 0)
+            {
+                printf("        0x%02X, 0x%02X,\n", code[p - 2], code[p - 1]);
+            }
+        }
+        i += j;
+    }
+    return p;
+}
+
+/**
+ * @brief      decode a table
+ * @param[in]  *code pointer to a code buffer
+ * @param[in]  len code length
+ * @param[out] *out pointer to a write buffer
+ * @param[out] *count pointer to a write count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 decode failed
+ * @note       follows the interpreter in driver_ov2640.c
+ */
+static uint8_t a_decode(const uint8_t *code, uint16_t len, table_write_t *out, uint16_t *count)
+{
+    uint8_t op;
+    uint8_t bank;
+    uint16_t i;
+    uint16_t j;
+    uint16_t n;
+    uint16_t size;
+    
+    bank = 0xFF;
+    *count = 0;
+    i = 0;
+    while (i < len)
+    {
+        op = code[i++];
+        if (op == OV2640_CODE_END)
+        {
+            return 0;
+        }
+        if ((op & 0xFE) == OV2640_CODE_BANK)
+        {
+            bank = op & 0x01;
+            
+            continue;
+        }
+        if ((op == OV2640_CODE_DELAY) && (i < len) && (*count < TABLE_LOG_MAX))
+        {
+            out[*count].delay = 1;
+            out[*count].bank = bank;
+            out[*count].reg = 0;
+            out[*count].value = code[i++];
+            (*count)++;
+            
+            continue;
+        }
+        n = (op & 0x3F) + 1;
+        size = ((op & 0xC0) == OV2640_CODE_PAIR) ? (2 * n) : (((op & 0xC0) == OV2640_CODE_RUN) ? (n + 1) : 2);
+        if ((op < OV2640_CODE_FILL) || (i + size > len) || (*count + n > TABLE_LOG_MAX))
+        {
+            return 1;
+        }
+        for (j = 0; j < n; j++)
+        {
+            out[*count].delay = 0;
+            out[*count].bank = bank;
+            if ((op & 0xC0) == OV2640_CODE_PAIR)
+            {
+                out[*count].reg = code[i + 2 * j];
+                out[*count].value = code[i + 2 * j + 1];
+            }
+            else
+            {
+                out[*count].reg = (uint8_t)(code[i] + j);
+                out[*count].value = ((op & 0xC0) == OV2640_CODE_RUN) ? code[i + 1 + j] : code[i + 1];
+            }
+            (*count)++;
+        }
+        i += size;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  driver init
+ * @return status code
+ *         - 0 success
+ *         - 1 init failed
+ * @note   the simulated bus is reset by the init
+ */
+static uint8_t a_init(void)
+{
+    DRIVER_OV2640_LINK_INIT(&gs_handle, ov2640_handle_t);
+    DRIVER_OV2640_LINK_SCCB_INIT(&gs_handle, ov2640_interface_sccb_init);
+    DRIVER_OV2640_LINK_SCCB_DEINIT(&gs_handle, ov2640_interface_sccb_deinit);
+    DRIVER_OV2640_LINK_SCCB_READ(&gs_handle, ov2640_interface_sccb_read);
+    DRIVER_OV2640_LINK_SCCB_WRITE(&gs_handle, ov2640_interface_sccb_write);
+    DRIVER_OV2640_LINK_POWER_DOWN_INIT(&gs_handle, ov2640_interface_power_down_init);
+    DRIVER_OV2640_LINK_POWER_DOWN_DEINIT(&gs_handle, ov2640_interface_power_down_deinit);
+    DRIVER_OV2640_LINK_POWER_DOWN_WRITE(&gs_handle, ov2640_interface_power_down_write);
+    DRIVER_OV2640_LINK_RESET_INIT(&gs_handle, ov2640_interface_reset_init);
+    DRIVER_OV2640_LINK_RESET_DEINIT(&gs_handle, ov2640_interface_reset_deinit);
+    DRIVER_OV2640_LINK_RESET_WRITE(&gs_handle, ov2640_interface_reset_write);
+    DRIVER_OV2640_LINK_DELAY_MS(&gs_handle, ov2640_interface_delay_ms);
+    DRIVER_OV2640_LINK_DEBUG_PRINT(&gs_handle, ov2640_interface_debug_print);
+    if (ov2640_init(&gs_handle) != 0)
+    {
+        ov2640_interface_debug_print("ov2640: init failed.\n");
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      run a table on the simulated bus
+ * @param[in]  *item pointer to a table item
+ * @param[in]  flat 1 to replay the flat table, 0 to run the driver table
+ * @param[out] *stats pointer to a statistics structure
+ * @param[out] **image pointer to a register image buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 run failed
+ * @note       the flat table is replayed one register at a time like the old table path
+ */
+static uint8_t a_run(const table_item_t *item, uint8_t flat, sim_bus_stats_t *stats, uint8_t image[2][256])
+{
+    uint8_t res;
+    uint8_t bank;
+    uint16_t i;
+    uint16_t r;
+    
+    if (a_init() != 0)
+    {
+        return 1;
+    }
+    res = ov2640_set_burst_write(&gs_handle, OV2640_BOOL_TRUE);
+    sim_bus_clear_stats();
+    if (flat != 0)
+    {
+        bank = 0xFF;
+        for (i = 0; i < item->len; i++)
+        {
+            if (item->flat[i][0] == 0xFF)
+            {
+                bank = item->flat[i][1] & 0x01;
+                res |= ov2640_set_dsp_reg(&gs_handle, 0xFF, bank);
+            }
+            else if (bank == OV2640_BANK_SENSOR)
+            {
+                res |= ov2640_set_sensor_reg(&gs_handle, item->flat[i][0], item->flat[i][1]);
+            }
+            else
+            {
+                res |= ov2640_set_dsp_reg(&gs_handle, item->flat[i][0], item->flat[i][1]);
+            }
+        }
+    }
+    else
+    {
+        res |= item->load(&gs_handle);
+    }
+    sim_bus_get_stats(stats);
+    for (r = 0; r < 256; r++)
+    {
+        image[0][r] = sim_bus_peek(0, (uint8_t)r);
+        image[1][r] = sim_bus_peek(1, (uint8_t)r);
+    }
+    (void)ov2640_deinit(&gs_handle);
+    
+    return res;
+}
+
+/**
+ * @brief     write log
+ * @param[in] bank register bank
+ * @param[in] reg register address
+ * @param[in] value register value
+ * @note      writes after TABLE_LOG_MAX are counted but not saved
+ */
+static void a_log(uint8_t bank, uint8_t reg, uint8_t value)
+{
+    if (gs_log_len < TABLE_LOG_MAX)
+    {
+        gs_log[gs_log_len].delay = 0;
+        gs_log[gs_log_len].bank = bank;
+        gs_log[gs_log_len].reg = reg;
+        gs_log[gs_log_len].value = value;
+    }
+    gs_log_len++;
+}
+
+/**
+ * @brief     check an ordered write
+ * @param[in] *w pointer to a logged write
+ * @return    1 if the write keeps its place in the image
+ * @note      resets, bypass, address and data ports and the sccb protocol registers act on the write itself
+ */
+static uint8_t a_boot_ordered(const table_write_t *w)
+{
+    if (w->bank == OV2640_BANK_SENSOR)
+    {
+        return (w->reg == 0x12) && ((w->value & 0x80) != 0);          /* com7 software reset */
+    }
+    
+    return (w->reg == 0x05) || (w->reg == 0x7C) || (w->reg == 0x7D) ||       /* r_bypass, bpaddr and bpdata */
+           ((w->reg >= 0x90) && (w->reg <= 0x97)) ||                         /* indirect ports */
+           (w->reg == 0xE0) || (w->reg >= 0xF9);                             /* reset, mc and p registers */
+}
+
+/**
+ * @brief      make the boot image
+ * @param[out] **flat pointer to a flat table buffer
+ * @param[out] *len pointer to a flat table length buffer
+ * @param[out] *writes pointer to a basic init write count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 make failed
+ * @note       ov2640_basic_init is logged on the simulated bus and the writes of ov2640_init are dropped,
+ *             ordered writes are all kept in place, other registers keep only their last write,
+ *             which is sorted by bank and address between two ordered writes so that bursts can form
+ */
+static uint8_t a_boot_make(uint8_t (*flat)[2], uint16_t *len, uint16_t *writes)
+{
+    uint8_t bank;
+    uint16_t i;
+    uint16_t j;
+    uint16_t k;
+    uint16_t n;
+    uint16_t m;
+    table_write_t w;
+    static table_write_t init_log[TABLE_LOG_MAX];
+    static table_write_t image[TABLE_LOG_MAX];
+    
+    sim_bus_set_log(a_log);
+    gs_log_len = 0;
+    if (a_init() != 0)
+    {
+        sim_bus_set_log(NULL);
+        
+        return 1;
+    }
+    n = gs_log_len;
+    memcpy(init_log, gs_log, sizeof(init_log));
+    (void)ov2640_deinit(&gs_handle);
+    gs_log_len = 0;
+    if (ov2640_basic_init() != 0)
+    {
+        sim_bus_set_log(NULL);
+        
+        return 1;
+    }
+    sim_bus_set_log(NULL);
+    (void)ov2640_basic_deinit();
+    if ((gs_log_len > TABLE_LOG_MAX) || (n > gs_log_len) || (memcmp(init_log, gs_log, n * sizeof(table_write_t)) != 0))
+    {
+        printf("ov2640: basic init log is invalid.\n");
+        
+        return 1;
+    }
+    *writes = gs_log_len - n;
+    
+    /* keep the ordered writes and the last write of the other registers */
+    m = 0;
+    for (i = n; i < gs_log_len; i++)
+    {
+        if (a_boot_ordered(&gs_log[i]) == 0)
+        {
+            for (j = i + 1; j < gs_log_len; j++)
+            {
+                if ((gs_log[j].bank == gs_log[i].bank) && (gs_log[j].reg == gs_log[i].reg))
+                {
+                    break;
+                }
+            }
+            if (j < gs_log_len)
+            {
+                continue;
+            }
+        }
+        image[m++] = gs_log[i];
+    }
+    
+    /* sort the writes between two ordered writes */
+    for (i = 0; i < m; i++)
+    {
+        if (a_boot_ordered(&image[i]) != 0)
+        {
+            continue;
+        }
+        for (j = i + 1; (j < m) && (a_boot_ordered(&image[j]) == 0); j++)
+        {
+            w = image[j];
+            k = j;
+            while ((k > i) && ((image[k - 1].bank > w.bank) ||
+                   ((image[k - 1].bank == w.bank) && (image[k - 1].reg > w.reg))))
+            {
+                image[k] = image[k - 1];
+                k--;
+            }
+            image[k] = w;
+        }
+        i = j - 1;
+    }
+    
+    /* insert the bank selects */
+    bank = 0xFF;
+    *len = 0;
+    for (i = 0; i < m; i++)
+    {
+        if (image[i].bank != bank)
+        {
+            bank = image[i].bank;
+            flat[*len][0] = 0xFF;
+            flat[*len][1] = bank;
+            (*len)++;
+        }
+        flat[*len][0] = image[i].reg;
+        flat[*len][1] = image[i].value;
+        (*len)++;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      run a basic init on the simulated bus
+ * @param[in]  fast 1 to run ov2640_basic_fast_init, 0 to run ov2640_basic_init
+ * @param[out] *stats pointer to a statistics structure
+ * @param[out] **image pointer to a register image buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 run failed
+ * @note       the statistics cover the whole init
+ */
+static uint8_t a_boot_run(uint8_t fast, sim_bus_stats_t *stats, uint8_t image[2][256])
+{
+    uint8_t res;
+    uint16_t r;
+    
+    res = (fast != 0) ? ov2640_basic_fast_init() : ov2640_basic_init();
+    if (res != 0)
+    {
+        return 1;
+    }
+    sim_bus_get_stats(stats);
+    for (r = 0; r < 256; r++)
+    {
+        image[0][r] = sim_bus_peek(0, (uint8_t)r);
+        image[1][r] = sim_bus_peek(1, (uint8_t)r);
+    }
+    (void)ov2640_basic_deinit();
+    
+    return 0;
+}
+
+/**
+ * @brief  print the boot image
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   the output is pasted into driver_ov2640_basic.c
+ */
+static uint8_t a_boot_print(void)
+{
+    uint16_t len;
+    uint16_t writes;
+    static uint8_t flat[TABLE_LOG_MAX][2];
+    uint8_t code[TABLE_CODE_SIZE_MAX];
+    
+    if (a_boot_make(flat, &len, &writes) != 0)
+    {
+        return 1;
+    }
+    printf("/**\n * @brief basic boot image definition\n */\n");
+    printf("static const uint8_t gsc_ov2640_basic_boot_table[] = \n{\n");
+    (void)a_encode((const uint8_t (*)[2])flat, len, code, 1);
+    printf("};\n");
+    
+    return 0;
+}
+
+/**
+ * @brief  check the boot image
+ * @return status code
+ *         - 0 success
+ *         - 1 check failed
+ * @note   ov2640_basic_fast_init must leave the same register image as ov2640_basic_init
+ */
+static uint8_t a_boot_check(void)
+{
+    uint8_t ok;
+    uint16_t i;
+    uint16_t len;
+    uint16_t writes;
+    uint16_t image_writes;
+    static uint8_t flat[TABLE_LOG_MAX][2];
+    static uint8_t basic_image[2][256];
+    static uint8_t fast_image[2][256];
+    uint8_t code[TABLE_CODE_SIZE_MAX];
+    sim_bus_stats_t basic_stats;
+    sim_bus_stats_t fast_stats;
+    
+    if (a_boot_make(flat, &len, &writes) != 0)
+    {
+        return 1;
+    }
+    image_writes = 0;
+    for (i = 0; i < len; i++)
+    {
+        if (flat[i][0] != 0xFF)
+        {
+            image_writes++;
+        }
+    }
+    if (a_boot_run(0, &basic_stats, basic_image) != 0)
+    {
+        return 1;
+    }
+    if (a_boot_run(1, &fast_stats, fast_image) != 0)
+    {
+        return 1;
+    }
+    ok = (memcmp(basic_image, fast_image, sizeof(basic_image)) == 0);
+    printf("ov2640: boot image writes %d -> %d, %d bytes, transactions %d -> %d, bus %d -> %d us, check %s.\n",
+           (int)writes, (int)image_writes, (int)a_encode((const uint8_t (*)[2])flat, len, code, 0),
+           (int)(basic_stats.read + basic_stats.write), (int)(fast_stats.read + fast_stats.write),
+           (int)basic_stats.time_us, (int)fast_stats.time_us, ok ? "ok" : "error");
+    
+    return ok ? 0 : 1;
+}
+
+/**
+ * @brief  print the format register map
+ * @note   every register written by the jpeg and rgb565 init tables has its bit set
+ */
+static void a_format_map_print(void)
+{
+    uint8_t i;
+    uint16_t j;
+    uint16_t n;
+    uint8_t map[2][32];
+    static table_write_t w[TABLE_LOG_MAX];
+    
+    memset(map, 0, sizeof(map));
+    for (i = 1; i < sizeof(gsc_table) / sizeof(gsc_table[0]); i++)
+    {
+        n = a_flat_expand(gsc_table[i].flat, gsc_table[i].len, w);
+        for (j = 0; j < n; j++)
+        {
+            if (w[j].bank <= 1)
+            {
+                map[w[j].bank][w[j].reg / 8] |= (uint8_t)(1 << (w[j].reg % 8));
+            }
+        }
+    }
+    printf("/**\n * @brief format register map definition\n */\n");
+    printf("static const uint8_t gsc_ov2640_format_map[2][32] =\n{\n");
+    for (i = 0; i < 2; i++)
+    {
+        printf("    {\n");
+        for (j = 0; j < 32; j++)
+        {
+            printf("%s0x%02X,%s", ((j % 16) == 0) ? "        " : " ", map[i][j], ((j % 16) == 15) ? "\n" : "");
+        }
+        printf("    },\n");
+    }
+    printf("};\n\n");
+}
+
+/**
+ * @brief  print the encoded tables
+ * @return status code
+ *         - 0 success
+ * @note   the output is pasted into driver_ov2640.c
+ */
+static uint8_t a_encode_run(void)
+{
+    uint8_t i;
+    uint8_t code[TABLE_CODE_SIZE_MAX];
+    
+    for (i = 0; i < sizeof(gsc_table) / sizeof(gsc_table[0]); i++)
+    {
+        printf("/**\n * @brief %s table definition\n */\n", gsc_table[i].brief);
+        printf("static const uint8_t gsc_ov2640_%s_table[] = \n{\n", gsc_table[i].name);
+        (void)a_encode(gsc_table[i].flat, gsc_table[i].len, code, 1);
+        printf("};\n\n");
+    }
+    a_format_map_print();
+    
+    return 0;
+}
+
+/**
+ * @brief  check the encoded tables
+ * @return status code
+ *         - 0 success
+ *         - 1 check failed
+ * @note   the decoded table must match the flat table and both must leave the same register image
+ */
+static uint8_t a_check_run(void)
+{
+    uint8_t res;
+    uint8_t i;
+    uint8_t ok;
+    uint16_t len;
+    uint16_t n;
+    uint16_t m;
+    uint8_t code[TABLE_CODE_SIZE_MAX];
+    static table_write_t a[TABLE_LOG_MAX];
+    static table_write_t b[TABLE_LOG_MAX];
+    static uint8_t flat_image[2][256];
+    static uint8_t code_image[2][256];
+    sim_bus_stats_t flat_stats;
+    sim_bus_stats_t code_stats;
+    
+    res = 0;
+    for (i = 0; i < sizeof(gsc_table) / sizeof(gsc_table[0]); i++)
+    {
+        len = a_encode(gsc_table[i].flat, gsc_table[i].len, code, 0);
+        n = a_flat_expand(gsc_table[i].flat, gsc_table[i].len, a);
+        ok = (a_decode(code, len, b, &m) == 0) && (n == m) && (memcmp(a, b, n * sizeof(table_write_t)) == 0);
+        if (a_run(&gsc_table[i], 1, &flat_stats, flat_image) != 0)
+        {
+            return 1;
+        }
+        if (a_run(&gsc_table[i], 0, &code_stats, code_image) != 0)
+        {
+            return 1;
+        }
+        ok = ok && (memcmp(flat_image, code_image, sizeof(flat_image)) == 0);
+        printf("ov2640: %s table %d -> %d bytes, transactions %d -> %d, bus %d -> %d us, check %s.\n", gsc_table[i].name,
+               (int)(gsc_table[i].len * 2), (int)len, (int)(flat_stats.read + flat_stats.write),
+               (int)(code_stats.read + code_stats.write), (int)flat_stats.time_us, (int)code_stats.time_us, ok ? "ok" : "error");
+        if (!ok)
+        {
+            res = 1;
+        }
+    }
+    
+    return res;
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      run "encode" to print the encoded tables, "boot" to print the basic boot image
+ *            or "check" to compare them with the flat tables and ov2640_basic_init
+ */
+int main(int argc, char **argv)
+{
+    if ((argc >= 2) && (strcmp(argv[1], "encode") == 0))
+    {
+        return a_encode_run();
+    }
+    if ((argc >= 2) && (strcmp(argv[1], "boot") == 0))
+    {
+        return a_boot_print();
+    }
+    
+    return a_check_run() | a_boot_check();
+}
@@ -0,0 +1,598 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      trace.c
+ * @brief     trace tool source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-16
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/16  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ov2640.h"
+#include "driver_ov2640_interface.h"
+#include "sim_bus.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief trace tool definition
+ * @note  a trace file is the entries in time order, 8 bytes each: the timestamp in little endian, the bank,
+ *        the register, the value and the flag, as ov2640_trace_entry_t is laid out on a little endian mcu
+ */
+#define TRACE_ENTRY_SIZE        8            /**< file entry size */
+#define TRACE_ENTRY_MAX         16384        /**< max entries */
+#define TRACE_PHASE_MAX         64           /**< max phases */
+#define TRACE_TOP_MAX           8            /**< redundant registers printed */
+
+/**
+ * @brief trace phase structure definition
+ */
+typedef struct trace_phase_s
+{
+    uint8_t id;                        /**< mark id, 0 before the first mark */
+    uint32_t transactions;             /**< transactions */
+    uint32_t reads;                    /**< read transactions */
+    uint32_t writes;                   /**< write transactions */
+    uint32_t bytes;                    /**< data bytes */
+    uint32_t bank_switches;            /**< ra_dlmt writes */
+    uint32_t redundant_switches;       /**< ra_dlmt writes of the selected bank */
+    uint32_t redundant_writes;         /**< writes of the known value */
+    uint32_t failed;                   /**< failed transactions */
+    uint32_t mismatches;               /**< replayed reads that differ from the trace */
+    uint32_t start_us;                 /**< first timestamp */
+    uint32_t end_us;                   /**< last timestamp */
+    uint64_t replay_us;                /**< simulated bus time */
+} trace_phase_t;
+
+/**
+ * @brief trace result structure definition
+ */
+typedef struct trace_result_s
+{
+    uint16_t phase_len;                                /**< phase count */
+    trace_phase_t phase[TRACE_PHASE_MAX];              /**< phases */
+    uint16_t redundant[2][256];                        /**< redundant writes per register */
+} trace_result_t;
+
+static ov2640_handle_t gs_handle;                                 /**< ov2640 handle */
+static ov2640_trace_entry_t gs_ring[TRACE_ENTRY_MAX];             /**< trace ring */
+static ov2640_trace_entry_t gs_trace[TRACE_ENTRY_MAX];            /**< trace in time order */
+static trace_result_t gs_result;                                  /**< replay result */
+
+/**
+ * @brief     quiet debug print
+ * @param[in] fmt format data
+ * @note      the driver messages go to stderr
+ */
+static void a_print(const char *const fmt, ...)
+{
+    va_list args;
+    
+    va_start(args, fmt);
+    (void)vfprintf(stderr, fmt, args);
+    va_end(args);
+}
+
+/**
+ * @brief     check if a register holds the written value
+ * @param[in] bank register bank
+ * @param[in] reg register address
+ * @return    1 if a write of the same value has an effect
+ * @note      the same list as the driver shadow
+ */
+static uint8_t a_volatile(uint8_t bank, uint8_t reg)
+{
+    static const uint8_t sensor[] = {0x00, 0x10, 0x12, 0x2D, 0x2E, 0x2F, 0x45, 0xFF};
+    static const uint8_t dsp[] = {0x7C, 0x7D, 0x90, 0x91, 0x92, 0x93, 0x96, 0x97, 0xE0, 0xF9, 0xFA, 0xFB, 0xFC, 0xFD, 0xFE, 0xFF};
+    const uint8_t *list;
+    uint8_t len;
+    uint8_t i;
+    
+    list = (bank == OV2640_BANK_SENSOR) ? sensor : dsp;
+    len = (bank == OV2640_BANK_SENSOR) ? sizeof(sensor) : sizeof(dsp);
+    for (i = 0; i < len; i++)
+    {
+        if (list[i] == reg)
+        {
+            return 1;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     record a sequence on the simulated chip
+ * @param[in] transfer 1 links the sccb_transfer function
+ * @param[out] *len pointer to an entry count buffer
+ * @param[out] *total pointer to a recorded entry count buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 record failed
+ * @note      marks: 1 init, 2 table init, 3 rgb565, 4 jpeg, 5 rgb565 again, 6 settings, 7 deinit,
+ *            the trace is copied to gs_trace in time order
+ */
+static uint8_t a_record(uint8_t transfer, uint16_t *len, uint32_t *total)
+{
+    uint8_t res;
+    uint16_t first;
+    uint16_t count;
+    uint16_t i;
+    
+    DRIVER_OV2640_LINK_INIT(&gs_handle, ov2640_handle_t);
+    DRIVER_OV2640_LINK_SCCB_INIT(&gs_handle, ov2640_interface_sccb_init);
+    DRIVER_OV2640_LINK_SCCB_DEINIT(&gs_handle, ov2640_interface_sccb_deinit);
+    DRIVER_OV2640_LINK_SCCB_READ(&gs_handle, ov2640_interface_sccb_read);
+    DRIVER_OV2640_LINK_SCCB_WRITE(&gs_handle, ov2640_interface_sccb_write);
+    if (transfer != 0)
+    {
+        DRIVER_OV2640_LINK_SCCB_TRANSFER(&gs_handle, ov2640_interface_sccb_transfer);
+    }
+    DRIVER_OV2640_LINK_POWER_DOWN_INIT(&gs_handle, ov2640_interface_power_down_init);
+    DRIVER_OV2640_LINK_POWER_DOWN_DEINIT(&gs_handle, ov2640_interface_power_down_deinit);
+    DRIVER_OV2640_LINK_POWER_DOWN_WRITE(&gs_handle, ov2640_interface_power_down_write);
+    DRIVER_OV2640_LINK_RESET_INIT(&gs_handle, ov2640_interface_reset_init);
+    DRIVER_OV2640_LINK_RESET_DEINIT(&gs_handle, ov2640_interface_reset_deinit);
+    DRIVER_OV2640_LINK_RESET_WRITE(&gs_handle, ov2640_interface_reset_write);
+    DRIVER_OV2640_LINK_DELAY_MS(&gs_handle, ov2640_interface_delay_ms);
+    DRIVER_OV2640_LINK_DEBUG_PRINT(&gs_handle, a_print);
+    DRIVER_OV2640_LINK_TIMESTAMP_US(&gs_handle, ov2640_interface_timestamp_us);
+    
+    if (ov2640_set_trace(&gs_handle, gs_ring, TRACE_ENTRY_MAX) != 0)
+    {
+        printf("ov2640: trace is disabled.\n");
+        
+        return 1;
+    }
+    res = ov2640_trace_mark(&gs_handle, 1);
+    res |= ov2640_init(&gs_handle);
+    if (res != 0)
+    {
+        return 1;
+    }
+    res |= ov2640_trace_mark(&gs_handle, 2);
+    res |= ov2640_table_init(&gs_handle);
+    res |= ov2640_trace_mark(&gs_handle, 3);
+    res |= ov2640_table_rgb565_init(&gs_handle);
+    res |= ov2640_trace_mark(&gs_handle, 4);
+    res |= ov2640_table_jpeg_init(&gs_handle);
+    res |= ov2640_trace_mark(&gs_handle, 5);
+    res |= ov2640_table_rgb565_init(&gs_handle);
+    res |= ov2640_trace_mark(&gs_handle, 6);
+    res |= ov2640_set_light_mode(&gs_handle, OV2640_LIGHT_MODE_SUNNY);
+    res |= ov2640_set_color_saturation(&gs_handle, OV2640_COLOR_SATURATION_POSITIVE_1);
+    res |= ov2640_set_brightness(&gs_handle, OV2640_BRIGHTNESS_0);
+    res |= ov2640_set_contrast(&gs_handle, OV2640_CONTRAST_POSITIVE_1);
+    res |= ov2640_set_special_effect(&gs_handle, OV2640_SPECIAL_EFFECT_NORMAL);
+    res |= ov2640_set_horizontal_mirror(&gs_handle, OV2640_BOOL_TRUE);
+    res |= ov2640_trace_mark(&gs_handle, 7);
+    res |= ov2640_deinit(&gs_handle);
+    res |= ov2640_get_trace(&gs_handle, &first, &count, total);
+    (void)ov2640_set_trace(&gs_handle, NULL, 0);
+    if (res != 0)
+    {
+        return 1;
+    }
+    for (i = 0; i < count; i++)
+    {
+        gs_trace[i] = gs_ring[(first + i) % TRACE_ENTRY_MAX];
+    }
+    *len = count;
+    
+    return 0;
+}
+
+/**
+ * @brief     save the trace to a file
+ * @param[in] *path pointer to a file path
+ * @param[in] len entry count
+ * @return    status code
+ *            - 0 success
+ *            - 1 save failed
+ * @note      none
+ */
+static uint8_t a_save(const char *path, uint16_t len)
+{
+    FILE *f;
+    uint8_t buf[TRACE_ENTRY_SIZE];
+    uint16_t i;
+    
+    f = fopen(path, "wb");
+    if (f == NULL)
+    {
+        printf("ov2640: can't open %s.\n", path);
+        
+        return 1;
+    }
+    for (i = 0; i < len; i++)
+    {
+        buf[0] = (uint8_t)(gs_trace[i].timestamp >> 0);
+        buf[1] = (uint8_t)(gs_trace[i].timestamp >> 8);
+        buf[2] = (uint8_t)(gs_trace[i].timestamp >> 16);
+        buf[3] = (uint8_t)(gs_trace[i].timestamp >> 24);
+        buf[4] = gs_trace[i].bank;
+        buf[5] = gs_trace[i].reg;
+        buf[6] = gs_trace[i].value;
+        buf[7] = gs_trace[i].flag;
+        if (fwrite(buf, 1, TRACE_ENTRY_SIZE, f) != TRACE_ENTRY_SIZE)
+        {
+            (void)fclose(f);
+            
+            return 1;
+        }
+    }
+    (void)fclose(f);
+    
+    return 0;
+}
+
+/**
+ * @brief      load the trace from a file
+ * @param[in]  *path pointer to a file path
+ * @param[out] *len pointer to an entry count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 load failed
+ * @note       none
+ */
+static uint8_t a_load(const char *path, uint16_t *len)
+{
+    FILE *f;
+    uint8_t buf[TRACE_ENTRY_SIZE];
+    uint16_t i;
+    
+    f = fopen(path, "rb");
+    if (f == NULL)
+    {
+        printf("ov2640: can't open %s.\n", path);
+        
+        return 1;
+    }
+    for (i = 0; (i < TRACE_ENTRY_MAX) && (fread(buf, 1, TRACE_ENTRY_SIZE, f) == TRACE_ENTRY_SIZE); i++)
+    {
+        gs_trace[i].timestamp = (uint32_t)buf[0] | ((uint32_t)buf[1] << 8) | ((uint32_t)buf[2] << 16) | ((uint32_t)buf[3] << 24);
+        gs_trace[i].bank = buf[4];
+        gs_trace[i].reg = buf[5];
+        gs_trace[i].value = buf[6];
+        gs_trace[i].flag = buf[7];
+    }
+    (void)fclose(f);
+    *len = i;
+    
+    return 0;
+}
+
+/**
+ * @brief     replay the trace
+ * @param[in] len entry count
+ * @param[in] hz replay sccb clock
+ * @note      the transactions are run on a freshly reset simulated chip, failed transactions are skipped,
+ *            a write is redundant when the register is known to hold the value from an earlier write or read
+ */
+static void a_replay(uint16_t len, uint32_t hz)
+{
+    static uint8_t known[2][256];
+    static uint8_t known_valid[2][256];
+    uint8_t data[256];
+    uint8_t bank;
+    uint8_t tbank;
+    uint16_t i;
+    uint16_t j;
+    uint16_t n;
+    uint16_t k;
+    trace_phase_t *phase;
+    sim_bus_stats_t stats;
+    
+    memset(&gs_result, 0, sizeof(gs_result));
+    memset(known_valid, 0, sizeof(known_valid));
+    sim_bus_set_retain(0);
+    (void)sim_bus_init();
+    sim_bus_set_clock(hz);
+    sim_bus_clear_stats();
+    bank = 0xFF;
+    gs_result.phase_len = 1;
+    phase = &gs_result.phase[0];
+    phase->start_us = (len != 0) ? gs_trace[0].timestamp : 0;
+    phase->end_us = phase->start_us;
+    for (i = 0; i < len; i = j)
+    {
+        j = (uint16_t)(i + 1);
+        if ((gs_trace[i].flag & OV2640_TRACE_FLAG_MARK) != 0)
+        {
+            sim_bus_get_stats(&stats);
+            phase->replay_us = stats.time_us;
+            sim_bus_clear_stats();
+            if (gs_result.phase_len < TRACE_PHASE_MAX)
+            {
+                phase = &gs_result.phase[gs_result.phase_len++];
+            }
+            phase->id = gs_trace[i].value;
+            phase->start_us = gs_trace[i].timestamp;
+            phase->end_us = gs_trace[i].timestamp;
+            
+            continue;
+        }
+        while ((j < len) && ((gs_trace[j].flag & OV2640_TRACE_FLAG_NEXT) != 0))
+        {
+            j++;
+        }
+        n = (uint16_t)(j - i);
+        phase->end_us = gs_trace[j - 1].timestamp;
+        phase->transactions++;
+        phase->bytes += n;
+        if ((gs_trace[i].flag & OV2640_TRACE_FLAG_FAIL) != 0)
+        {
+            phase->failed++;
+            bank = 0xFF;
+            
+            continue;
+        }
+        tbank = gs_trace[i].bank & 0x01;
+        if ((gs_trace[i].reg != 0xFF) && (sim_bus_peek(tbank, 0xFF) != tbank))
+        {
+            data[0] = tbank;
+            (void)sim_bus_write(0x60, 0xFF, data, 1);
+        }
+        for (k = 0; k < n; k++)
+        {
+            data[k] = gs_trace[i + k].value;
+        }
+        if ((gs_trace[i].flag & OV2640_TRACE_FLAG_WRITE) != 0)
+        {
+            phase->writes++;
+            if (gs_trace[i].reg == 0xFF)
+            {
+                phase->bank_switches++;
+                if (bank == (data[0] & 0x01))
+                {
+                    phase->redundant_switches++;
+                }
+                bank = data[0] & 0x01;
+            }
+            else
+            {
+                for (k = 0; k < n; k++)
+                {
+                    if ((a_volatile(tbank, gs_trace[i + k].reg) == 0) && (known_valid[tbank][gs_trace[i + k].reg] != 0) &&
+                        (known[tbank][gs_trace[i + k].reg] == data[k]))
+                    {
+                        phase->redundant_writes++;
+                        gs_result.redundant[tbank][gs_trace[i + k].reg]++;
+                    }
+                    known[tbank][gs_trace[i + k].reg] = data[k];
+                    known_valid[tbank][gs_trace[i + k].reg] = 1;
+                }
+            }
+            (void)sim_bus_write(0x60, gs_trace[i].reg, data, n);
+        }
+        else
+        {
+            phase->reads++;
+            (void)sim_bus_read(0x60, gs_trace[i].reg, data, n);
+            for (k = 0; k < n; k++)
+            {
+                if ((gs_trace[i].reg != 0xFF) && (a_volatile(tbank, gs_trace[i + k].reg) == 0))
+                {
+                    if (data[k] != gs_trace[i + k].value)
+                    {
+                        phase->mismatches++;
+                    }
+                    known[tbank][gs_trace[i + k].reg] = gs_trace[i + k].value;
+                    known_valid[tbank][gs_trace[i + k].reg] = 1;
+                }
+            }
+        }
+    }
+    sim_bus_get_stats(&stats);
+    phase->replay_us = stats.time_us;
+}
+
+/**
+ * @brief     print the replay result
+ * @param[in] hz replay sccb clock
+ * @note      none
+ */
+static void a_result_print(uint32_t hz)
+{
+    trace_phase_t total;
+    trace_phase_t *p;
+    uint16_t i;
+    uint16_t bank;
+    uint16_t reg;
+    uint16_t best_bank;
+    uint16_t best_reg;
+    uint16_t max;
+    
+    memset(&total, 0, sizeof(total));
+    printf("phase,transactions,reads,writes,bytes,bank_switches,redundant_switches,redundant_writes,failed,mismatches,trace_us,replay_us\n");
+    for (i = 0; i < gs_result.phase_len; i++)
+    {
+        p = &gs_result.phase[i];
+        if ((p->transactions == 0) && (i == 0))
+        {
+            continue;
+        }
+        printf("%d,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%llu\n", p->id, (unsigned)p->transactions, (unsigned)p->reads,
+               (unsigned)p->writes, (unsigned)p->bytes, (unsigned)p->bank_switches, (unsigned)p->redundant_switches,
+               (unsigned)p->redundant_writes, (unsigned)p->failed, (unsigned)p->mismatches,
+               (unsigned)(p->end_us - p->start_us), (unsigned long long)p->replay_us);
+        total.transactions += p->transactions;
+        total.reads += p->reads;
+        total.writes += p->writes;
+        total.bytes += p->bytes;
+        total.bank_switches += p->bank_switches;
+        total.redundant_switches += p->redundant_switches;
+        total.redundant_writes += p->redundant_writes;
+        total.failed += p->failed;
+        total.mismatches += p->mismatches;
+        total.replay_us += p->replay_us;
+    }
+    printf("ov2640: %u transactions, %u bank switches (%u redundant), %u redundant writes, %u failed, %u read mismatches, "
+           "replay %llu us at %u hz.\n", (unsigned)total.transactions, (unsigned)total.bank_switches,
+           (unsigned)total.redundant_switches, (unsigned)total.redundant_writes, (unsigned)total.failed,
+           (unsigned)total.mismatches, (unsigned long long)total.replay_us, (unsigned)hz);
+    for (i = 0; i < TRACE_TOP_MAX; i++)
+    {
+        max = 0;
+        best_bank = 0;
+        best_reg = 0;
+        for (bank = 0; bank < 2; bank++)
+        {
+            for (reg = 0; reg < 256; reg++)
+            {
+                if (gs_result.redundant[bank][reg] > max)
+                {
+                    max = gs_result.redundant[bank][reg];
+                    best_bank = bank;
+                    best_reg = reg;
+                }
+            }
+        }
+        if (max == 0)
+        {
+            break;
+        }
+        printf("ov2640: redundant %s 0x%02X x %d.\n", (best_bank == OV2640_BANK_SENSOR) ? "sensor" : "dsp", best_reg, max);
+        gs_result.redundant[best_bank][best_reg] = 0;
+    }
+}
+
+/**
+ * @brief  run the check command
+ * @return status code
+ *         - 0 success
+ *         - 1 check failed
+ * @note   a recorded sequence must replay without read mismatches and with the recorded transaction count,
+ *         a hand made trace must show one redundant bank switch and one redundant write
+ */
+static uint8_t a_check_run(void)
+{
+    static const ov2640_trace_entry_t manual[5] =
+    {
+        {0, OV2640_BANK_DSP, 0xFF, 0x00, OV2640_TRACE_FLAG_WRITE},
+        {0, OV2640_BANK_DSP, 0x44, 0x0C, OV2640_TRACE_FLAG_WRITE},
+        {0, OV2640_BANK_DSP, 0xFF, 0x00, OV2640_TRACE_FLAG_WRITE},
+        {0, OV2640_BANK_DSP, 0x44, 0x0C, OV2640_TRACE_FLAG_WRITE},
+        {0, OV2640_BANK_DSP, 0x7D, 0x0C, OV2640_TRACE_FLAG_WRITE},
+    };
+    uint8_t res;
+    uint8_t transfer;
+    uint16_t i;
+    uint16_t len;
+    uint32_t total;
+    uint32_t transactions;
+    uint32_t mismatches;
+    uint32_t failed;
+    sim_bus_stats_t stats;
+    
+    res = 0;
+    for (transfer = 0; transfer < 2; transfer++)
+    {
+        (void)sim_bus_init();
+        sim_bus_clear_stats();
+        if (a_record(transfer, &len, &total) != 0)
+        {
+            return 1;
+        }
+        sim_bus_get_stats(&stats);
+        a_replay(len, 100000);
+        transactions = 0;
+        mismatches = 0;
+        failed = 0;
+        for (i = 0; i < gs_result.phase_len; i++)
+        {
+            transactions += gs_result.phase[i].transactions;
+            mismatches += gs_result.phase[i].mismatches;
+            failed += gs_result.phase[i].failed;
+        }
+        printf("ov2640: check %s record %s.\n", (transfer != 0) ? "transfer" : "direct",
+               ((total == len) && (transactions == stats.read + stats.write) && (mismatches == 0) && (failed == 0) &&
+               (gs_result.phase_len == 8)) ? "ok" : "error");
+        res |= ((total == len) && (transactions == stats.read + stats.write) && (mismatches == 0) && (failed == 0) &&
+                (gs_result.phase_len == 8)) ? 0 : 1;
+    }
+    memcpy(gs_trace, manual, sizeof(manual));
+    a_replay(5, 100000);
+    printf("ov2640: check redundancy %s.\n", ((gs_result.phase[0].redundant_switches == 1) &&
+           (gs_result.phase[0].redundant_writes == 1)) ? "ok" : "error");
+    res |= ((gs_result.phase[0].redundant_switches == 1) && (gs_result.phase[0].redundant_writes == 1)) ? 0 : 1;
+    printf("ov2640: check trace result %s.\n", (res == 0) ? "ok" : "error");
+    
+    return res;
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      "record <file>" records init, the format tables and the settings on the simulated chip,
+ *            "replay <file> [hz]" replays a trace and prints a csv line per phase, "check" checks the replay
+ */
+int main(int argc, char **argv)
+{
+    uint16_t len;
+    uint32_t total;
+    uint32_t hz;
+    
+    if ((argc < 2) || (strcmp(argv[1], "check") == 0))
+    {
+        return a_check_run();
+    }
+    if ((strcmp(argv[1], "record") == 0) && (argc == 3))
+    {
+        (void)sim_bus_init();
+        if ((a_record(1, &len, &total) != 0) || (a_save(argv[2], len) != 0))
+        {
+            return 1;
+        }
+        printf("ov2640: %d entries, %u lost.\n", len, (unsigned)(total - len));
+        
+        return 0;
+    }
+    if ((strcmp(argv[1], "replay") == 0) && ((argc == 3) || (argc == 4)))
+    {
+        hz = (argc == 4) ? (uint32_t)strtoul(argv[3], NULL, 0) : 100000;
+        if ((hz == 0) || (a_load(argv[2], &len) != 0))
+        {
+            return 1;
+        }
+        a_replay(len, hz);
+        a_result_print(hz);
+        
+        return 0;
+    }
+    printf("ov2640: usage ov2640_trace [record <file> | replay <file> [hz] | check].\n");
+    
+    return 1;
+}
@@ -0,0 +1,1154 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      main.c
+ * @brief     main source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-16
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/16  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_ov2640_basic.h"
+#include "sim_bus.h"
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * @brief global var definition
+ */
+static ov2640_handle_t gs_handle;        /**< ov2640 handle */
+static uint32_t gs_done;                 /**< completed operation count */
+static uint32_t gs_error;                /**< failed operation count */
+static uint8_t gs_retry;                 /**< bus retry times */
+static uint16_t gs_ready;                /**< ready polling timeout in ms */
+static ov2640_mismatch_t gs_mismatch[8]; /**< mismatch list */
+
+/**
+ * @brief     queue callback
+ * @param[in] op queue operation
+ * @param[in] bank register bank
+ * @param[in] reg register address
+ * @param[in] data register value
+ * @param[in] res operation result
+ * @note      none
+ */
+static void a_queue_callback(ov2640_queue_op_t op, ov2640_bank_t bank, uint8_t reg, uint8_t data, uint8_t res)
+{
+    (void)op;
+    (void)bank;
+    (void)reg;
+    (void)data;
+    
+    gs_done++;
+    if (res != 0)
+    {
+        gs_error++;
+    }
+}
+
+/**
+ * @brief     link and init the chip
+ * @param[in] transfer bool value, link the sccb_transfer function
+ * @param[in] burst bool value, enable the burst write
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      the simulated bus is reset by the init
+ */
+static uint8_t a_init(ov2640_bool_t transfer, ov2640_bool_t burst)
+{
+    uint8_t res;
+    
+    /* link interface function */
+    DRIVER_OV2640_LINK_INIT(&gs_handle, ov2640_handle_t);
+    DRIVER_OV2640_LINK_SCCB_INIT(&gs_handle, ov2640_interface_sccb_init);
+    DRIVER_OV2640_LINK_SCCB_DEINIT(&gs_handle, ov2640_interface_sccb_deinit);
+    DRIVER_OV2640_LINK_SCCB_READ(&gs_handle, ov2640_interface_sccb_read);
+    DRIVER_OV2640_LINK_SCCB_WRITE(&gs_handle, ov2640_interface_sccb_write);
+    if (transfer == OV2640_BOOL_TRUE)
+    {
+        DRIVER_OV2640_LINK_SCCB_TRANSFER(&gs_handle, ov2640_interface_sccb_transfer);
+    }
+    DRIVER_OV2640_LINK_POWER_DOWN_INIT(&gs_handle, ov2640_interface_power_down_init);
+    DRIVER_OV2640_LINK_POWER_DOWN_DEINIT(&gs_handle, ov2640_interface_power_down_deinit);
+    DRIVER_OV2640_LINK_POWER_DOWN_WRITE(&gs_handle, ov2640_interface_power_down_write);
+    DRIVER_OV2640_LINK_RESET_INIT(&gs_handle, ov2640_interface_reset_init);
+    DRIVER_OV2640_LINK_RESET_DEINIT(&gs_handle, ov2640_interface_reset_deinit);
+    DRIVER_OV2640_LINK_RESET_WRITE(&gs_handle, ov2640_interface_reset_write);
+    DRIVER_OV2640_LINK_DELAY_MS(&gs_handle, ov2640_interface_delay_ms);
+    DRIVER_OV2640_LINK_DEBUG_PRINT(&gs_handle, ov2640_interface_debug_print);
+    DRIVER_OV2640_LINK_QUEUE_CALLBACK(&gs_handle, a_queue_callback);
+    DRIVER_OV2640_LINK_TIMESTAMP_US(&gs_handle, ov2640_interface_timestamp_us);
+    
+    /* set the retry before the init so that the init is retried too */
+    res = ov2640_set_retry(&gs_handle, gs_retry, 1, 8);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: set retry failed.\n");
+        
+        return 1;
+    }
+    res = ov2640_set_ready_polling(&gs_handle, gs_ready);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: set ready polling failed.\n");
+        
+        return 1;
+    }
+    
+    /* init */
+    res = ov2640_init(&gs_handle);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: init failed.\n");
+        
+        return 1;
+    }
+    res = ov2640_set_burst_write(&gs_handle, burst);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: set burst write failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     run the setter sequence
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      the module enables share a few ctrl registers
+ */
+static uint8_t a_sequence(ov2640_bool_t enable)
+{
+    uint8_t res;
+    
+    res = 0;
+    res |= ov2640_set_cip(&gs_handle, enable);
+    res |= ov2640_set_dmy(&gs_handle, enable);
+    res |= ov2640_set_raw_gma(&gs_handle, enable);
+    res |= ov2640_set_dg(&gs_handle, enable);
+    res |= ov2640_set_awb(&gs_handle, enable);
+    res |= ov2640_set_awb_gain(&gs_handle, enable);
+    res |= ov2640_set_lenc(&gs_handle, enable);
+    res |= ov2640_set_pre(&gs_handle, enable);
+    res |= ov2640_set_bpc(&gs_handle, enable);
+    res |= ov2640_set_wpc(&gs_handle, enable);
+    res |= ov2640_set_light_mode(&gs_handle, enable == OV2640_BOOL_TRUE ? OV2640_LIGHT_MODE_SUNNY : OV2640_LIGHT_MODE_HOME);
+    res |= ov2640_set_contrast(&gs_handle, enable == OV2640_BOOL_TRUE ? OV2640_CONTRAST_POSITIVE_2 : OV2640_CONTRAST_NEGATIVE_2);
+    
+    return res;
+}
+
+/**
+ * @brief      snapshot the simulated registers
+ * @param[out] **image pointer to a register image buffer
+ * @note       none
+ */
+static void a_snapshot(uint8_t image[2][256])
+{
+    uint16_t i;
+    
+    for (i = 0; i < 255; i++)
+    {
+        image[0][i] = sim_bus_peek(0, (uint8_t)i);
+        image[1][i] = sim_bus_peek(1, (uint8_t)i);
+    }
+    image[0][255] = 0;
+    image[1][255] = 0;
+}
+
+/**
+ * @brief  queue mode run
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   the same sequence is run blocking and queued
+ */
+static uint8_t a_queue_run(void)
+{
+    uint8_t res;
+    uint16_t pending;
+    uint32_t steps;
+    uint64_t last;
+    uint64_t step_max;
+    uint64_t enqueue_us;
+    uint64_t sync_us;
+    uint64_t total_us;
+    static uint8_t queued[2][256];
+    static uint8_t direct[2][256];
+    sim_bus_stats_t stats;
+    
+    if (a_init(OV2640_BOOL_FALSE, OV2640_BOOL_TRUE) != 0)
+    {
+        return 1;
+    }
+    res = ov2640_table_init(&gs_handle);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: table init failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* blocking run */
+    sim_bus_clear_stats();
+    if (a_sequence(OV2640_BOOL_FALSE) != 0)
+    {
+        ov2640_interface_debug_print("ov2640: run sequence failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    sim_bus_get_stats(&stats);
+    sync_us = stats.time_us;
+    
+    /* queued run */
+    res = ov2640_set_queue_mode(&gs_handle, OV2640_BOOL_TRUE);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: set queue mode failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    gs_done = 0;
+    gs_error = 0;
+    sim_bus_clear_stats();
+    if (a_sequence(OV2640_BOOL_TRUE) != 0)
+    {
+        ov2640_interface_debug_print("ov2640: run sequence failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    sim_bus_get_stats(&stats);
+    enqueue_us = stats.time_us;
+    last = stats.time_us;
+    step_max = 0;
+    steps = 0;
+    do
+    {
+        res = ov2640_queue_step(&gs_handle, &pending);
+        if (res != 0)
+        {
+            ov2640_interface_debug_print("ov2640: queue step failed.\n");
+            (void)ov2640_deinit(&gs_handle);
+            
+            return 1;
+        }
+        sim_bus_get_stats(&stats);
+        if (stats.time_us - last > step_max)
+        {
+            step_max = stats.time_us - last;
+        }
+        last = stats.time_us;
+        steps++;
+    } while (pending != 0);
+    total_us = stats.time_us;
+    a_snapshot(queued);
+    res = ov2640_set_queue_mode(&gs_handle, OV2640_BOOL_FALSE);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: set queue mode failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* the blocking path must not find anything left to change */
+    if (a_sequence(OV2640_BOOL_TRUE) != 0)
+    {
+        ov2640_interface_debug_print("ov2640: run sequence failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    a_snapshot(direct);
+    (void)ov2640_deinit(&gs_handle);
+    
+    ov2640_interface_debug_print("ov2640: blocking sequence %d us.\n", (int)sync_us);
+    ov2640_interface_debug_print("ov2640: queued sequence enqueue %d us, %d steps, max step %d us, total %d us.\n",
+                                 (int)enqueue_us, (int)steps, (int)step_max, (int)total_us);
+    ov2640_interface_debug_print("ov2640: %d operations completed, %d failed.\n", (int)gs_done, (int)gs_error);
+    res = ((memcmp(queued, direct, sizeof(queued)) == 0) && (gs_error == 0)) ? 0 : 1;
+    ov2640_interface_debug_print("ov2640: check queue result %s.\n", res == 0 ? "ok" : "error");
+    
+    return res;
+}
+
+/**
+ * @brief      table load and batch run
+ * @param[in]  transfer bool value, link the sccb_transfer function
+ * @param[in]  burst bool value, enable the burst write
+ * @param[out] *stats pointer to a statistics structure
+ * @param[out] **image pointer to a register image buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 run failed
+ * @note       none
+ */
+static uint8_t a_load(ov2640_bool_t transfer, ov2640_bool_t burst, sim_bus_stats_t *stats, uint8_t image[2][256])
+{
+    uint8_t res;
+    
+    if (a_init(transfer, burst) != 0)
+    {
+        return 1;
+    }
+    sim_bus_clear_stats();
+    res = 0;
+    res |= ov2640_table_init(&gs_handle);
+    res |= ov2640_table_jpeg_init(&gs_handle);
+    res |= a_sequence(OV2640_BOOL_TRUE);
+    res |= ov2640_set_special_effect(&gs_handle, OV2640_SPECIAL_EFFECT_ANTIQUE);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: load failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    sim_bus_get_stats(stats);
+    a_snapshot(image);
+    (void)ov2640_deinit(&gs_handle);
+    
+    return 0;
+}
+
+/**
+ * @brief  sccb transfer run
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   the bus function calls are compared with and without the sccb_transfer function
+ */
+static uint8_t a_transfer_run(void)
+{
+    uint8_t res;
+    uint8_t i;
+    ov2640_bool_t burst;
+    static uint8_t single[2][256];
+    static uint8_t vector[2][256];
+    sim_bus_stats_t a;
+    sim_bus_stats_t b;
+    
+    res = 0;
+    for (i = 0; i < 2; i++)
+    {
+        burst = (i == 0) ? OV2640_BOOL_FALSE : OV2640_BOOL_TRUE;
+        if (a_load(OV2640_BOOL_FALSE, burst, &a, single) != 0)
+        {
+            return 1;
+        }
+        if (a_load(OV2640_BOOL_TRUE, burst, &b, vector) != 0)
+        {
+            return 1;
+        }
+        ov2640_interface_debug_print("ov2640: burst %s, read/write calls %d, transfer calls %d, transactions %d/%d, bus %d/%d us.\n",
+                                     burst == OV2640_BOOL_TRUE ? "on" : "off", (int)a.call, (int)b.call,
+                                     (int)(a.read + a.write), (int)(b.read + b.write), (int)a.time_us, (int)b.time_us);
+        if (memcmp(single, vector, sizeof(single)) != 0)
+        {
+            res = 1;
+        }
+    }
+    ov2640_interface_debug_print("ov2640: check transfer result %s.\n", res == 0 ? "ok" : "error");
+    
+    return res;
+}
+
+/**
+ * @brief      retry load
+ * @param[in]  late 1 nacks the writes after their data bytes
+ * @param[out] *stats pointer to a sim bus stats structure
+ * @param[out] image register image after the load
+ * @return     status code
+ *             - 0 success
+ *             - 1 load failed
+ * @note       the table load runs with every 17th bus transaction nacked
+ */
+static uint8_t a_retry_load(uint8_t late, sim_bus_stats_t *stats, uint8_t image[2][256])
+{
+    uint8_t res;
+    ov2640_error_stats_t error;
+    
+    gs_retry = 3;
+    if (a_init(OV2640_BOOL_FALSE, OV2640_BOOL_TRUE) != 0)
+    {
+        return 1;
+    }
+    sim_bus_set_fault_late(late);
+    sim_bus_set_fault(17);
+    sim_bus_clear_stats();
+    res = 0;
+    res |= ov2640_table_init(&gs_handle);
+    res |= ov2640_table_jpeg_init(&gs_handle);
+    res |= a_sequence(OV2640_BOOL_TRUE);
+    res |= ov2640_set_special_effect(&gs_handle, OV2640_SPECIAL_EFFECT_ANTIQUE);
+    sim_bus_set_fault(0);
+    sim_bus_set_fault_late(0);
+    sim_bus_get_stats(stats);
+    res |= ov2640_get_error_stats(&gs_handle, &error);
+    a_snapshot(image);
+    (void)ov2640_deinit(&gs_handle);
+    gs_retry = 0;
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: load failed.\n");
+        
+        return 1;
+    }
+    ov2640_interface_debug_print("ov2640: %s %d, retries %d, failures %d, last failing register 0x%02X in bank %d.\n",
+                                 late != 0 ? "late nack" : "nack", (int)stats->nack, (int)error.retries,
+                                 (int)error.failures, error.last_reg, error.last_bank);
+    
+    return 0;
+}
+
+/**
+ * @brief      retry port
+ * @param[in]  late 1 nacks the data port write after its data
+ * @param[out] *sde pointer to a 16 bytes sde register buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 run failed
+ * @note       bpaddr is set, bpdata is read and then written, the read moves the sde address
+ */
+static uint8_t a_retry_port(uint8_t late, uint8_t *sde)
+{
+    uint8_t res;
+    uint8_t data;
+    uint8_t i;
+    
+    gs_retry = 3;
+    if (a_init(OV2640_BOOL_FALSE, OV2640_BOOL_TRUE) != 0)
+    {
+        return 1;
+    }
+    res = 0;
+    res |= ov2640_set_sde_indirect_register_address(&gs_handle, 0x05);
+    res |= ov2640_get_sde_indirect_register_data(&gs_handle, &data);
+    sim_bus_set_fault_late(late);
+    sim_bus_set_fault_once(late);
+    res |= ov2640_set_sde_indirect_register_data(&gs_handle, (uint8_t)(data + 0x20));
+    sim_bus_set_fault_once(0);
+    sim_bus_set_fault_late(0);
+    for (i = 0; i < 16; i++)
+    {
+        sde[i] = sim_bus_peek_sde(i);
+    }
+    (void)ov2640_deinit(&gs_handle);
+    gs_retry = 0;
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: port load failed.\n");
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  retry run
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   the table load runs again with every 17th bus transaction nacked,
+ *         once after the address phase and once after the data,
+ *         then a bpdata write after a bpdata read is nacked after its data
+ */
+static uint8_t a_retry_run(void)
+{
+    uint8_t res;
+    static uint8_t clean[2][256];
+    static uint8_t fault[2][256];
+    static uint8_t late[2][256];
+    uint8_t sde_clean[16];
+    uint8_t sde_late[16];
+    sim_bus_stats_t a;
+    sim_bus_stats_t b;
+    sim_bus_stats_t c;
+    
+    gs_retry = 0;
+    if (a_load(OV2640_BOOL_FALSE, OV2640_BOOL_TRUE, &a, clean) != 0)
+    {
+        return 1;
+    }
+    if (a_retry_load(0, &b, fault) != 0)
+    {
+        return 1;
+    }
+    if (a_retry_load(1, &c, late) != 0)
+    {
+        return 1;
+    }
+    ov2640_interface_debug_print("ov2640: bus %d us clean, %d us with nack, %d us with late nack.\n",
+                                 (int)a.time_us, (int)b.time_us, (int)c.time_us);
+    if ((a_retry_port(0, sde_clean) != 0) || (a_retry_port(1, sde_late) != 0))
+    {
+        return 1;
+    }
+    ov2640_interface_debug_print("ov2640: sde 0x05/0x06 after read and write 0x%02X/0x%02X clean, 0x%02X/0x%02X with late nack.\n",
+                                 sde_clean[5], sde_clean[6], sde_late[5], sde_late[6]);
+    res = ((memcmp(clean, fault, sizeof(clean)) != 0) || (memcmp(clean, late, sizeof(clean)) != 0) ||
+           (memcmp(sde_clean, sde_late, sizeof(sde_clean)) != 0)) ? 1 : 0;
+    ov2640_interface_debug_print("ov2640: check retry result %s.\n", res == 0 ? "ok" : "error");
+    
+    return res;
+}
+
+/**
+ * @brief      format toggle
+ * @param[in]  delta bool value, use ov2640_switch_output_format
+ * @param[out] *us pointer to a bus time buffer of the four switches
+ * @param[out] **image pointer to a register image buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 run failed
+ * @note       the formats are toggled jpeg, rgb565, jpeg, rgb565 after the init table
+ */
+static uint8_t a_toggle(ov2640_bool_t delta, uint32_t us[4], uint8_t image[2][256])
+{
+    uint8_t res;
+    uint8_t i;
+    ov2640_output_format_t format;
+    sim_bus_stats_t stats;
+    
+    if (a_init(OV2640_BOOL_FALSE, OV2640_BOOL_TRUE) != 0)
+    {
+        return 1;
+    }
+    res = ov2640_table_init(&gs_handle);
+    for (i = 0; i < 4; i++)
+    {
+        format = ((i % 2) == 0) ? OV2640_OUTPUT_FORMAT_JPEG : OV2640_OUTPUT_FORMAT_RGB565;
+        sim_bus_clear_stats();
+        if (delta == OV2640_BOOL_TRUE)
+        {
+            res |= ov2640_switch_output_format(&gs_handle, format);
+        }
+        else if (format == OV2640_OUTPUT_FORMAT_JPEG)
+        {
+            res |= ov2640_table_jpeg_init(&gs_handle);
+        }
+        else
+        {
+            res |= ov2640_table_rgb565_init(&gs_handle);
+        }
+        sim_bus_get_stats(&stats);
+        us[i] = (uint32_t)stats.time_us;
+    }
+    a_snapshot(image);
+    (void)ov2640_deinit(&gs_handle);
+    
+    return res;
+}
+
+/**
+ * @brief  format switch run
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   the full format tables are compared with the format switch
+ */
+static uint8_t a_format_run(void)
+{
+    uint8_t res;
+    uint32_t full[4];
+    uint32_t delta[4];
+    static uint8_t a[2][256];
+    static uint8_t b[2][256];
+    
+    if (a_toggle(OV2640_BOOL_FALSE, full, a) != 0)
+    {
+        return 1;
+    }
+    if (a_toggle(OV2640_BOOL_TRUE, delta, b) != 0)
+    {
+        return 1;
+    }
+    ov2640_interface_debug_print("ov2640: table jpeg/rgb565/jpeg/rgb565 %d/%d/%d/%d us.\n",
+                                 (int)full[0], (int)full[1], (int)full[2], (int)full[3]);
+    ov2640_interface_debug_print("ov2640: switch jpeg/rgb565/jpeg/rgb565 %d/%d/%d/%d us.\n",
+                                 (int)delta[0], (int)delta[1], (int)delta[2], (int)delta[3]);
+    res = (memcmp(a, b, sizeof(a)) != 0) ? 1 : 0;
+    ov2640_interface_debug_print("ov2640: check format result %s.\n", res == 0 ? "ok" : "error");
+    
+    return res;
+}
+
+/**
+ * @brief  image resolution run
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   all resolutions are switched in a row, once with the width and height setters
+ *         and once with the register images of the basic example, which must keep the zoom speed
+ */
+static uint8_t a_resolution_run(void)
+{
+    uint8_t res;
+    uint8_t i;
+    uint8_t speed;
+    uint8_t reg[13][3];
+    uint32_t us[13];
+    sim_bus_stats_t stats;
+    static const uint16_t size[13][2] =
+    {
+        {160, 120}, {176, 144}, {320, 240}, {400, 240}, {352, 288}, {640, 480}, {800, 600},
+        {1024, 768}, {1280, 800}, {1280, 960}, {1440, 900}, {1280, 1024}, {1600, 1200},
+    };
+    
+    /* setters */
+    if (a_init(OV2640_BOOL_FALSE, OV2640_BOOL_TRUE) != 0)
+    {
+        return 1;
+    }
+    res = 0;
+    for (i = 0; i < 13; i++)
+    {
+        sim_bus_clear_stats();
+        res |= ov2640_set_output_width(&gs_handle, size[i][0] / 4);
+        res |= ov2640_set_output_height(&gs_handle, size[i][1] / 4);
+        sim_bus_get_stats(&stats);
+        us[i] = (uint32_t)stats.time_us;
+        reg[i][0] = sim_bus_peek(0, 0x5A);
+        reg[i][1] = sim_bus_peek(0, 0x5B);
+        reg[i][2] = sim_bus_peek(0, 0x5C);
+    }
+    (void)ov2640_deinit(&gs_handle);
+    
+    /* register images, the zoom speed of the init must survive */
+    if (ov2640_basic_init() != 0)
+    {
+        return 1;
+    }
+    speed = sim_bus_peek(0, 0x5C) >> 4;
+    for (i = 0; i < 13; i++)
+    {
+        sim_bus_clear_stats();
+        res |= ov2640_basic_set_image_resolution((ov2640_image_resolution_t)i);
+        sim_bus_get_stats(&stats);
+        if ((sim_bus_peek(0, 0x5A) != reg[i][0]) || (sim_bus_peek(0, 0x5B) != reg[i][1]) ||
+            ((sim_bus_peek(0, 0x5C) & 0x07) != (reg[i][2] & 0x07)) || ((sim_bus_peek(0, 0x5C) >> 4) != speed) ||
+            (sim_bus_peek(0, 0xE0) != 0))
+        {
+            res = 1;
+        }
+        ov2640_interface_debug_print("ov2640: %4d x %4d setters %d us, image %d us.\n",
+                                     size[i][0], size[i][1], (int)us[i], (int)stats.time_us);
+    }
+    (void)ov2640_basic_deinit();
+    ov2640_interface_debug_print("ov2640: check resolution result %s.\n", res == 0 ? "ok" : "error");
+    
+    return res;
+}
+
+/**
+ * @brief  warm init run
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   the mcu restart is simulated by dropping the handle while the simulated bus keeps the registers
+ */
+static uint8_t a_warm_run(void)
+{
+    uint8_t res;
+    uint16_t checksum;
+    ov2640_bool_t warm[2];
+    uint32_t us[3];
+    sim_bus_stats_t stats;
+    static uint8_t image[2][2][256];
+    
+    /* cold init */
+    sim_bus_clear_stats();
+    if (ov2640_basic_init() != 0)
+    {
+        return 1;
+    }
+    sim_bus_get_stats(&stats);
+    us[0] = (uint32_t)stats.time_us;
+    res = ov2640_basic_get_checksum(&checksum);
+    a_snapshot(image[0]);
+    
+    /* restart with the sensor powered */
+    sim_bus_set_retain(1);
+    sim_bus_clear_stats();
+    res |= ov2640_basic_warm_init(checksum, &warm[0]);
+    sim_bus_get_stats(&stats);
+    us[1] = (uint32_t)stats.time_us;
+    a_snapshot(image[1]);
+    if (memcmp(image[0], image[1], sizeof(image[0])) != 0)
+    {
+        res = 1;
+    }
+    
+    /* change the resolution without a new checksum and restart again */
+    res |= ov2640_basic_set_image_resolution(OV2640_IMAGE_RESOLUTION_QQVGA);
+    sim_bus_clear_stats();
+    res |= ov2640_basic_warm_init(checksum, &warm[1]);
+    sim_bus_get_stats(&stats);
+    us[2] = (uint32_t)stats.time_us;
+    a_snapshot(image[1]);
+    if (memcmp(image[0], image[1], sizeof(image[0])) != 0)
+    {
+        res = 1;
+    }
+    (void)ov2640_basic_deinit();
+    sim_bus_set_retain(0);
+    
+    ov2640_interface_debug_print("ov2640: checksum 0x%04X, cold init %d us, warm init %d us %s, changed %d us %s.\n",
+                                 checksum, (int)us[0], (int)us[1], warm[0] == OV2640_BOOL_TRUE ? "kept" : "reloaded",
+                                 (int)us[2], warm[1] == OV2640_BOOL_TRUE ? "kept" : "reloaded");
+    if ((warm[0] != OV2640_BOOL_TRUE) || (warm[1] != OV2640_BOOL_FALSE))
+    {
+        res = 1;
+    }
+    ov2640_interface_debug_print("ov2640: check warm result %s.\n", res == 0 ? "ok" : "error");
+    
+    return res;
+}
+
+/**
+ * @brief     ready wait run
+ * @param[in] timeout ready polling timeout in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      prints the init and soft reset time and the ready stats
+ */
+static uint8_t a_ready(uint16_t timeout)
+{
+    uint8_t res;
+    uint32_t us[2];
+    sim_bus_stats_t stats;
+    ov2640_ready_stats_t ready;
+    ov2640_error_stats_t error;
+    
+    gs_ready = timeout;
+    sim_bus_clear_stats();
+    res = a_init(OV2640_BOOL_FALSE, OV2640_BOOL_TRUE);
+    gs_ready = 0;
+    if (res != 0)
+    {
+        return 1;
+    }
+    sim_bus_get_stats(&stats);
+    us[0] = (uint32_t)stats.time_us;
+    sim_bus_clear_stats();
+    res = ov2640_soft_reset(&gs_handle);
+    sim_bus_get_stats(&stats);
+    us[1] = (uint32_t)stats.time_us;
+    res |= ov2640_get_ready_stats(&gs_handle, &ready);
+    res |= ov2640_get_error_stats(&gs_handle, &error);
+    (void)ov2640_deinit(&gs_handle);
+    ov2640_interface_debug_print("ov2640: polling %3d ms, init %6d us, soft reset %5d us, ready last %2d ms max %2d ms, "
+                                 "%d waits, %d timeouts, %d failures.\n", timeout, (int)us[0], (int)us[1], ready.last_ms,
+                                 ready.max_ms, (int)ready.waits, (int)ready.timeouts, (int)error.failures);
+    if ((ready.waits != 3) || (error.failures != 0))
+    {
+        res = 1;
+    }
+    
+    return res;
+}
+
+/**
+ * @brief  ready wait run
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   the simulated chip is busy for 3ms after a soft reset,
+ *         the init and a soft reset are run with the fixed delays, with the polling and with a polling timeout
+ */
+static uint8_t a_ready_run(void)
+{
+    uint8_t res;
+    
+    sim_bus_set_reset_time(3000);
+    res = a_ready(0);
+    res |= a_ready(100);
+    res |= a_ready(2);
+    sim_bus_set_reset_time(0);
+    ov2640_interface_debug_print("ov2640: check ready result %s.\n", res == 0 ? "ok" : "error");
+    
+    return res;
+}
+
+/**
+ * @brief      verify load
+ * @param[in]  verify bool value
+ * @param[out] *us pointer to a bus time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 run failed
+ *             - 4 table verify failed
+ * @note       loads the init and jpeg tables, the jpeg table is skipped after a failure
+ */
+static uint8_t a_verify(ov2640_bool_t verify, uint32_t *us)
+{
+    uint8_t res;
+    sim_bus_stats_t stats;
+    
+    if (a_init(OV2640_BOOL_FALSE, OV2640_BOOL_TRUE) != 0)
+    {
+        return 1;
+    }
+    res = ov2640_set_table_verify(&gs_handle, verify, gs_mismatch, 8);
+    sim_bus_clear_stats();
+    if (res == 0)
+    {
+        res = ov2640_table_init(&gs_handle);
+    }
+    if (res == 0)
+    {
+        res = ov2640_table_jpeg_init(&gs_handle);
+    }
+    sim_bus_get_stats(&stats);
+    *us = (uint32_t)stats.time_us;
+    
+    return res;
+}
+
+/**
+ * @brief  table verify run
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   the tables are loaded without the verify, with the verify and with a stuck com9 bit on the simulated bus
+ */
+static uint8_t a_verify_run(void)
+{
+    uint8_t res;
+    uint8_t stuck;
+    uint16_t count;
+    uint16_t i;
+    uint32_t us[3];
+    
+    res = a_verify(OV2640_BOOL_FALSE, &us[0]);
+    (void)ov2640_deinit(&gs_handle);
+    res |= a_verify(OV2640_BOOL_TRUE, &us[1]);
+    res |= ov2640_get_table_mismatch_count(&gs_handle, &count);
+    (void)ov2640_deinit(&gs_handle);
+    if (count != 0)
+    {
+        res = 1;
+    }
+    ov2640_interface_debug_print("ov2640: init and jpeg tables %d us, with verify %d us.\n", (int)us[0], (int)us[1]);
+    
+    /* com9 bit6 reads 0 */
+    sim_bus_set_stuck(OV2640_BANK_SENSOR, 0x14, 0x40);
+    stuck = a_verify(OV2640_BOOL_TRUE, &us[2]);
+    res |= ov2640_get_table_mismatch_count(&gs_handle, &count);
+    (void)ov2640_deinit(&gs_handle);
+    sim_bus_set_stuck(0, 0, 0);
+    for (i = 0; (i < count) && (i < 8); i++)
+    {
+        ov2640_interface_debug_print("ov2640: mismatch bank %d reg 0x%02X expect 0x%02X actual 0x%02X.\n",
+                                     gs_mismatch[i].bank, gs_mismatch[i].reg, gs_mismatch[i].expect, gs_mismatch[i].actual);
+    }
+    if ((stuck != 4) || (count != 1))
+    {
+        res = 1;
+    }
+    ov2640_interface_debug_print("ov2640: check verify result %s.\n", res == 0 ? "ok" : "error");
+    
+    return res;
+}
+
+/**
+ * @brief     apply a scene profile with the setters
+ * @param[in] profile 0 day, 1 night, 2 indoor
+ * @return    status code
+ *            - 0 success
+ *            - 1 apply failed
+ * @note      none
+ */
+static uint8_t a_profile(uint8_t profile)
+{
+    static const ov2640_light_mode_t light[3] = {OV2640_LIGHT_MODE_SUNNY, OV2640_LIGHT_MODE_AUTO, OV2640_LIGHT_MODE_OFFICE};
+    static const ov2640_color_saturation_t saturation[3] = {OV2640_COLOR_SATURATION_POSITIVE_1, OV2640_COLOR_SATURATION_NEGATIVE_1,
+                                                            OV2640_COLOR_SATURATION_0};
+    static const ov2640_brightness_t brightness[3] = {OV2640_BRIGHTNESS_0, OV2640_BRIGHTNESS_POSITIVE_2, OV2640_BRIGHTNESS_POSITIVE_1};
+    static const ov2640_contrast_t contrast[3] = {OV2640_CONTRAST_POSITIVE_1, OV2640_CONTRAST_NEGATIVE_1, OV2640_CONTRAST_0};
+    static const ov2640_agc_gain_t agc[3] = {OV2640_AGC_4X, OV2640_AGC_64X, OV2640_AGC_16X};
+    static const ov2640_dummy_frame_t frame[3] = {OV2640_DUMMY_FRAME_NONE, OV2640_DUMMY_FRAME_3, OV2640_DUMMY_FRAME_1};
+    uint8_t res;
+    
+    res = 0;
+    res |= ov2640_set_light_mode(&gs_handle, light[profile]);
+    res |= ov2640_set_color_saturation(&gs_handle, saturation[profile]);
+    res |= ov2640_set_brightness(&gs_handle, brightness[profile]);
+    res |= ov2640_set_contrast(&gs_handle, contrast[profile]);
+    res |= ov2640_set_special_effect(&gs_handle, OV2640_SPECIAL_EFFECT_NORMAL);
+    res |= ov2640_set_agc_gain_ceiling(&gs_handle, agc[profile]);
+    res |= ov2640_set_dummy_frame(&gs_handle, frame[profile]);
+    
+    return res;
+}
+
+/**
+ * @brief      snapshot the simulated registers and the sde indirect registers
+ * @param[out] **image pointer to a register image buffer
+ * @param[out] *sde pointer to an sde register buffer
+ * @note       the indirect address and data ports are cleared
+ */
+static void a_snapshot_sde(uint8_t image[2][256], uint8_t sde[OV2640_SETTINGS_SDE_MAX])
+{
+    uint8_t i;
+    
+    a_snapshot(image);
+    image[0][0x7C] = 0;
+    image[0][0x7D] = 0;
+    for (i = 0; i < OV2640_SETTINGS_SDE_MAX; i++)
+    {
+        sde[i] = sim_bus_peek_sde(i);
+    }
+}
+
+/**
+ * @brief  settings run
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   the profiles are switched with the setters and then with the saved settings
+ */
+static uint8_t a_settings_run(void)
+{
+    uint8_t res;
+    uint8_t p;
+    uint8_t i;
+    uint8_t sde[2][OV2640_SETTINGS_SDE_MAX];
+    uint32_t us[3];
+    sim_bus_stats_t stats;
+    static uint8_t blob[3][OV2640_SETTINGS_SIZE];
+    static uint8_t image[2][3][2][256];
+    static uint8_t sde_image[3][OV2640_SETTINGS_SDE_MAX];
+    
+    if (a_init(OV2640_BOOL_FALSE, OV2640_BOOL_TRUE) != 0)
+    {
+        return 1;
+    }
+    res = ov2640_table_init(&gs_handle);
+    res |= ov2640_table_jpeg_init(&gs_handle);
+    
+    /* save the profiles */
+    for (p = 0; p < 3; p++)
+    {
+        res |= a_profile(p);
+        sim_bus_clear_stats();
+        res |= ov2640_save_settings(&gs_handle, blob[p], OV2640_SETTINGS_SIZE);
+        sim_bus_get_stats(&stats);
+        us[p] = (uint32_t)stats.time_us;
+    }
+    ov2640_interface_debug_print("ov2640: blob %d bytes, save day/night/indoor %d/%d/%d us.\n",
+                                 OV2640_SETTINGS_SIZE, (int)us[0], (int)us[1], (int)us[2]);
+    
+    /* switch with the setters and then with the saved settings */
+    for (i = 0; i < 2; i++)
+    {
+        for (p = 0; p < 3; p++)
+        {
+            sim_bus_clear_stats();
+            if (i == 0)
+            {
+                res |= a_profile(p);
+            }
+            else
+            {
+                res |= ov2640_restore_settings(&gs_handle, blob[p], OV2640_SETTINGS_SIZE);
+            }
+            sim_bus_get_stats(&stats);
+            us[p] = (uint32_t)stats.time_us;
+            a_snapshot_sde(image[i][p], sde[i]);
+            if (i == 0)
+            {
+                memcpy(sde_image[p], sde[0], OV2640_SETTINGS_SDE_MAX);
+            }
+            else if ((memcmp(image[0][p], image[1][p], sizeof(image[0][p])) != 0) ||
+                     (memcmp(sde_image[p], sde[1], OV2640_SETTINGS_SDE_MAX) != 0))
+            {
+                res = 1;
+            }
+        }
+        ov2640_interface_debug_print("ov2640: %s day/night/indoor %d/%d/%d us.\n",
+                                     i == 0 ? "setters" : "restore", (int)us[0], (int)us[1], (int)us[2]);
+    }
+    
+    /* a damaged blob is rejected */
+    blob[1][OV2640_SETTINGS_SIZE - 1] ^= 0x01;
+    if (ov2640_restore_settings(&gs_handle, blob[1], OV2640_SETTINGS_SIZE) != 5)
+    {
+        res = 1;
+    }
+    (void)ov2640_deinit(&gs_handle);
+    ov2640_interface_debug_print("ov2640: check settings result %s.\n", res == 0 ? "ok" : "error");
+    
+    return res;
+}
+
+/**
+ * @brief  perf run
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   a reconfiguration is timed with the simulated clock, the bus histograms must add up to the bus time
+ */
+static uint8_t a_perf_run(void)
+{
+    static const char *const name[OV2640_PERF_MAX] =
+    {
+        "init", "warm_init", "deinit", "table_init", "table_jpeg_init", "table_rgb565_init", "soft_reset",
+        "light_mode", "color_saturation", "brightness", "contrast", "special_effect", "switch_output_format",
+        "write_batch", "write_table", "load_script", "read_bank", "transaction_commit", "queue_flush",
+        "save_settings", "restore_settings", "sccb_read", "sccb_write", "sccb_transfer",
+    };
+    uint8_t res;
+    uint8_t p;
+    uint8_t i;
+    uint64_t bus;
+    ov2640_perf_stats_t perf;
+    sim_bus_stats_t stats;
+    static uint8_t blob[OV2640_SETTINGS_SIZE];
+    
+    if (ov2640_clear_perf_stats(&gs_handle) != 0)
+    {
+        ov2640_interface_debug_print("ov2640: perf is disabled.\n");
+        
+        return 0;
+    }
+    if (a_init(OV2640_BOOL_FALSE, OV2640_BOOL_TRUE) != 0)
+    {
+        return 1;
+    }
+    res = ov2640_table_init(&gs_handle);
+    res |= ov2640_table_jpeg_init(&gs_handle);
+    res |= ov2640_save_settings(&gs_handle, blob, OV2640_SETTINGS_SIZE);
+    res |= ov2640_switch_output_format(&gs_handle, OV2640_OUTPUT_FORMAT_RGB565);
+    for (p = 0; p < 3; p++)
+    {
+        res |= a_profile(p);
+    }
+    res |= ov2640_restore_settings(&gs_handle, blob, OV2640_SETTINGS_SIZE);
+    sim_bus_get_stats(&stats);
+    
+    /* print the histograms */
+    bus = 0;
+    for (i = 0; i < OV2640_PERF_MAX; i++)
+    {
+        res |= ov2640_get_perf_stats(&gs_handle, (ov2640_perf_t)i, &perf);
+        if (perf.count == 0)
+        {
+            continue;
+        }
+        if (i >= OV2640_PERF_SCCB_READ)
+        {
+            bus += perf.total_us;
+        }
+        ov2640_interface_debug_print("ov2640: %-20s %4d calls, mean %6d us, max %6d us, buckets %d/%d/%d/%d/%d/%d/%d/%d/%d/%d/%d/%d.\n",
+                                     name[i], (int)perf.count, (int)(perf.total_us / perf.count), (int)perf.max_us,
+                                     perf.bucket[0], perf.bucket[1], perf.bucket[2], perf.bucket[3], perf.bucket[4], perf.bucket[5],
+                                     perf.bucket[6], perf.bucket[7], perf.bucket[8], perf.bucket[9], perf.bucket[10], perf.bucket[11]);
+    }
+    (void)ov2640_deinit(&gs_handle);
+    ov2640_interface_debug_print("ov2640: bus histograms %d us, bus time %d us.\n", (int)bus, (int)(stats.time_us - stats.wait_us));
+    if (bus != stats.time_us - stats.wait_us)
+    {
+        res = 1;
+    }
+    ov2640_interface_debug_print("ov2640: check perf result %s.\n", res == 0 ? "ok" : "error");
+    
+    return res;
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      run "queue", "transfer", "retry", "format", "resolution", "warm", "ready", "verify", "settings", "perf" or everything without an argument
+ */
+int main(int argc, char **argv)
+{
+    uint8_t res;
+    
+    res = 0;
+    if ((argc < 2) || (strcmp(argv[1], "queue") == 0))
+    {
+        res |= a_queue_run();
+    }
+    if ((argc < 2) || (strcmp(argv[1], "transfer") == 0))
+    {
+        res |= a_transfer_run();
+    }
+    if ((argc < 2) || (strcmp(argv[1], "retry") == 0))
+    {
+        res |= a_retry_run();
+    }
+    if ((argc < 2) || (strcmp(argv[1], "format") == 0))
+    {
+        res |= a_format_run();
+    }
+    if ((argc < 2) || (strcmp(argv[1], "resolution") == 0))
+    {
+        res |= a_resolution_run();
+    }
+    if ((argc < 2) || (strcmp(argv[1], "warm") == 0))
+    {
+        res |= a_warm_run();
+    }
+    if ((argc < 2) || (strcmp(argv[1], "ready") == 0))
+    {
+        res |= a_ready_run();
+    }
+    if ((argc < 2) || (strcmp(argv[1], "verify") == 0))
+    {
+        res |= a_verify_run();
+    }
+    if ((argc < 2) || (strcmp(argv[1], "settings") == 0))
+    {
+        res |= a_settings_run();
+    }
+    if ((argc < 2) || (strcmp(argv[1], "perf") == 0))
+    {
+        res |= a_perf_run();
+    }
+    
+    return res;
+}
@@ -97,6 +97,40 @@ uint8_t ov2640_interface_sccb_write(uint8_t addr, uint8_t reg, uint8_t *buf, uin
     return iic_write(addr, reg, buf, len);
 }
 
+/**
+ * @brief     interface sccb bus transfer
+ * @param[in] *seg pointer to an sccb segment buffer
+ * @param[in] count number of segments
+ * @return    status code
+ *            - 0 success
+ *            - 1 transfer failed
+ * @note      the segments must be sent in order, it is optional and only used when it is linked
+ */
+uint8_t ov2640_interface_sccb_transfer(ov2640_sccb_segment_t *seg, uint16_t count)
+{
+    uint16_t i;
+    
+    for (i = 0; i < count; i++)
+    {
+        if (seg[i].dir == OV2640_SCCB_DIR_WRITE)
+        {
+            if (iic_write(seg[i].addr, seg[i].reg, seg[i].buf, seg[i].len) != 0)
+            {
+                return 1;
+            }
+        }
+        else
+        {
+            if (iic_read(seg[i].addr, seg[i].reg, seg[i].buf, seg[i].len) != 0)
+            {
+                return 1;
+            }
+        }
+    }
+    
+    return 0;
+}
+
 /**
  * @brief  interface power down init
  * @return status code
@@ -181,6 +215,25 @@ void ov2640_interface_delay_ms(uint32_t ms)
     delay_ms(ms);
 }
 
+/**
+ * @brief  interface timestamp us
+ * @return free running time in us
+ * @note   the hal tick and the systick counter at 168MHz
+ */
+uint32_t ov2640_interface_timestamp_us(void)
+{
+    uint32_t ms;
+    uint32_t val;
+    
+    do
+    {
+        ms = HAL_GetTick();
+        val = SysTick->VAL;
+    } while (ms != HAL_GetTick());
+    
+    return ms * 1000 + (SysTick->LOAD - val) / 168;
+}
+
 /**
  * @brief     interface print format data
  * @param[in] fmt format data
@@ -45,6 +45,64 @@
 extern "C"{
 #endif
 
+/**
+ * @brief ov2640 shadow register file definition
+ * @note  the shadow costs 2 x 256 bytes of register values, a 2 x 32 bytes valid bitmap and 14 bytes of sde registers
+ *        in the handle, about 590 bytes of ram, set 0 to remove it and keep only the last accessed register
+ */
+#ifndef OV2640_SHADOW_ENABLE
+    #define OV2640_SHADOW_ENABLE        1        /**< enable the shadow register file */
+#endif
+
+/**
+ * @brief ov2640 transaction stage size definition
+ * @note  number of distinct registers a transaction stages before it is flushed
+ */
+#ifndef OV2640_TRANSACTION_MAX
+    #define OV2640_TRANSACTION_MAX      32       /**< 32 staged registers */
+#endif
+
+/**
+ * @brief ov2640 queue size definition
+ * @note  number of register operations the queue mode holds before it runs the oldest one
+ */
+#ifndef OV2640_QUEUE_MAX
+    #define OV2640_QUEUE_MAX            32       /**< 32 queued operations */
+#endif
+
+/**
+ * @brief ov2640 sccb transfer collector definition
+ * @note  the collector holds 32 segments and 128 data bytes in the handle, about 520 bytes of ram on a 32 bit mcu,
+ *        set 0 to remove it, the writes are then sent with sccb_write even if sccb_transfer is linked
+ */
+#ifndef OV2640_TRANSFER_ENABLE
+    #define OV2640_TRANSFER_ENABLE      1        /**< enable the sccb transfer collector */
+#endif
+
+/**
+ * @brief ov2640 failure counter definition
+ * @note  set 1 to add the 2 x 256 bytes per register failure counters to the handle
+ */
+#ifndef OV2640_FAIL_COUNT_ENABLE
+    #define OV2640_FAIL_COUNT_ENABLE    0        /**< enable the per register failure counters */
+#endif
+
+/**
+ * @brief ov2640 trace definition
+ * @note  set 1 to add the bus trace recorder to the handle and to every bus call
+ */
+#ifndef OV2640_TRACE_ENABLE
+    #define OV2640_TRACE_ENABLE         0        /**< enable the bus trace recorder */
+#endif
+
+/**
+ * @brief ov2640 perf definition
+ * @note  set 1 to add the 24 x 36 bytes latency histograms to the handle and the timing to every api and bus call
+ */
+#ifndef OV2640_PERF_ENABLE
+    #define OV2640_PERF_ENABLE          0        /**< enable the latency histograms */
+#endif
+
 /**
  * @defgroup ov2640_driver ov2640 driver function
  * @brief    ov2640 driver modules
@@ -65,6 +123,15 @@ typedef enum
     OV2640_BOOL_TRUE  = 0x01,        /**< true */
 } ov2640_bool_t;
 
+/**
+ * @brief ov2640 bank enumeration definition
+ */
+typedef enum
+{
+    OV2640_BANK_DSP    = 0x00,        /**< dsp bank */
+    OV2640_BANK_SENSOR = 0x01,        /**< sensor bank */
+} ov2640_bank_t;
+
 /**
  * @brief ov2640 dummy frame enumeration definition
  */
@@ -312,6 +379,375 @@ typedef enum
     OV2640_SPECIAL_EFFECT_NORMAL      = 0x8,     /**< normal */
 } ov2640_special_effect_t;
 
+/**
+ * @brief ov2640 output format enumeration definition
+ */
+typedef enum
+{
+    OV2640_OUTPUT_FORMAT_JPEG   = 0x00,        /**< jpeg */
+    OV2640_OUTPUT_FORMAT_RGB565 = 0x01,        /**< rgb565 */
+} ov2640_output_format_t;
+
+/**
+ * @}
+ */
+
+/**
+ * @addtogroup ov2640_extend_driver
+ * @{
+ */
+
+/**
+ * @brief ov2640 batch entry structure definition
+ */
+typedef struct ov2640_batch_entry_s
+{
+    uint8_t bank;         /**< register bank */
+    uint8_t reg;          /**< register address */
+    uint8_t mask;         /**< written bits, 0xFF writes the whole register */
+    uint8_t value;        /**< register value */
+} ov2640_batch_entry_t;
+
+/**
+ * @brief ov2640 table code definition
+ * @note  an encoded register table is a byte stream of these opcodes, the table ends with the buffer or the end opcode,
+ *        registers before the first bank opcode are written to the current bank, run project/linux/tool to encode a flat table
+ */
+#define OV2640_CODE_END            0x00        /**< end of the table */
+#define OV2640_CODE_BANK           0x10        /**< 0x10 | bank, select the bank */
+#define OV2640_CODE_DELAY          0x20        /**< followed by the delay in ms */
+#define OV2640_CODE_FILL           0x40        /**< 0x40 | (n - 1), followed by the first reg and one value */
+#define OV2640_CODE_RUN            0x80        /**< 0x80 | (n - 1), followed by the first reg and n values */
+#define OV2640_CODE_PAIR           0xC0        /**< 0xC0 | (n - 1), followed by n reg and value pairs */
+#define OV2640_CODE_MASK           0x30        /**< scripts only, followed by the reg, the mask and the value */
+
+/**
+ * @brief ov2640 script definition
+ * @note  a script is a header followed by a body of table opcodes and masked writes, the header holds the magic,
+ *        the version, a reserved zero byte, the body length and the crc-16/ccitt of the body, both in big endian,
+ *        the body must select a bank before the first register, run project/linux/tool to compile a text script
+ */
+#define OV2640_SCRIPT_MAGIC0       0x4F        /**< magic 'O' */
+#define OV2640_SCRIPT_MAGIC1       0x56        /**< magic 'V' */
+#define OV2640_SCRIPT_VERSION      0x01        /**< script version */
+#define OV2640_SCRIPT_HEADER_SIZE  8           /**< header size */
+
+/**
+ * @brief ov2640 settings definition
+ * @note  a settings blob is a header of the magic, the version and the crc-16/ccitt of the payload in big endian,
+ *        the payload holds the configurable sensor and dsp registers in address order and then the sde indirect registers
+ */
+#define OV2640_SETTINGS_MAGIC          0x53        /**< magic 'S' */
+#define OV2640_SETTINGS_VERSION        0x01        /**< settings version */
+#define OV2640_SETTINGS_HEADER_SIZE    4           /**< header size */
+#define OV2640_SETTINGS_SDE_MAX        11          /**< sde indirect registers in a blob */
+#define OV2640_SETTINGS_SIZE           292         /**< blob size */
+
+/**
+ * @brief ov2640 trace flag definition
+ * @note  a transaction of n bytes is n trace entries, the registers of the next bytes follow the address auto increase
+ */
+#define OV2640_TRACE_FLAG_WRITE        0x01        /**< write, a read if cleared */
+#define OV2640_TRACE_FLAG_FAIL         0x02        /**< the bus call failed */
+#define OV2640_TRACE_FLAG_NEXT         0x04        /**< next byte of the previous transaction */
+#define OV2640_TRACE_FLAG_MARK         0x08        /**< phase mark, the value is the mark id */
+
+/**
+ * @brief ov2640 perf histogram definition
+ * @note  the bucket upper bounds are 50, 100, 200, 500 us, 1, 2, 5, 10, 20, 50 and 100 ms, the last bucket holds the rest
+ */
+#define OV2640_PERF_MAX                24          /**< timed apis and bus calls */
+#define OV2640_PERF_BUCKET_MAX         12          /**< histogram buckets */
+
+/**
+ * @brief ov2640 queue operation enumeration definition
+ */
+typedef enum
+{
+    OV2640_QUEUE_OP_WRITE = 0x00,        /**< register write */
+    OV2640_QUEUE_OP_READ  = 0x01,        /**< register read */
+} ov2640_queue_op_t;
+
+/**
+ * @brief ov2640 queue entry structure definition
+ */
+typedef struct ov2640_queue_entry_s
+{
+    uint8_t op;           /**< queue operation */
+    uint8_t bank;         /**< register bank */
+    uint8_t reg;          /**< register address */
+    uint8_t value;        /**< register value */
+} ov2640_queue_entry_t;
+
+/**
+ * @brief ov2640 sccb direction enumeration definition
+ */
+typedef enum
+{
+    OV2640_SCCB_DIR_WRITE = 0x00,        /**< write to the chip */
+    OV2640_SCCB_DIR_READ  = 0x01,        /**< read from the chip */
+} ov2640_sccb_dir_t;
+
+/**
+ * @brief ov2640 sccb segment structure definition
+ */
+typedef struct ov2640_sccb_segment_s
+{
+    uint8_t addr;         /**< sccb device write address */
+    uint8_t reg;          /**< register address */
+    uint8_t dir;          /**< sccb direction */
+    uint8_t *buf;         /**< pointer to a data buffer */
+    uint16_t len;         /**< length of the data buffer */
+} ov2640_sccb_segment_t;
+
+/**
+ * @brief ov2640 transfer collector size definition
+ */
+#define OV2640_TRANSFER_SEGMENT_MAX    32          /**< max segments in one sccb transfer */
+#define OV2640_TRANSFER_DATA_MAX       128         /**< max data bytes in one sccb transfer */
+
+/**
+ * @brief ov2640 transfer collector structure definition
+ */
+typedef struct ov2640_transfer_s
+{
+    ov2640_sccb_segment_t seg[OV2640_TRANSFER_SEGMENT_MAX];        /**< collected segments */
+    uint8_t buf[OV2640_TRANSFER_DATA_MAX];                         /**< segment data */
+    uint16_t seg_len;                                              /**< segment count */
+    uint16_t buf_len;                                              /**< used data length */
+    uint8_t bank;                                                  /**< bank of the first segment */
+} ov2640_transfer_t;
+
+/**
+ * @brief ov2640 error stats structure definition
+ */
+typedef struct ov2640_error_stats_s
+{
+    uint32_t attempts;         /**< failed bus attempts */
+    uint32_t retries;          /**< retried bus attempts */
+    uint32_t failures;         /**< bus operations failed after all retries */
+    uint8_t last_bank;         /**< bank of the last failing register, 0xFF means none */
+    uint8_t last_reg;          /**< last failing register address */
+} ov2640_error_stats_t;
+
+/**
+ * @brief ov2640 bus stats structure definition
+ */
+typedef struct ov2640_bus_stats_s
+{
+    uint32_t reads;            /**< read transactions */
+    uint32_t writes;           /**< write transactions */
+    uint32_t bank_switches;    /**< bank select writes */
+    uint32_t bytes;            /**< data bytes */
+    uint32_t failures;         /**< failed bus calls, the nacks of the ready polling included */
+    uint32_t time_us;          /**< time spent in the sccb functions in us */
+} ov2640_bus_stats_t;
+
+/**
+ * @brief ov2640 key register structure definition
+ */
+typedef struct ov2640_key_register_s
+{
+    uint8_t bank;         /**< register bank */
+    uint8_t reg;          /**< register address */
+    uint8_t mask;         /**< checked bits */
+} ov2640_key_register_t;
+
+/**
+ * @brief ov2640 ready stats structure definition
+ */
+typedef struct ov2640_ready_stats_s
+{
+    uint16_t last_ms;          /**< last ready time in ms */
+    uint16_t max_ms;           /**< max ready time in ms */
+    uint32_t waits;            /**< ready waits since init */
+    uint32_t timeouts;         /**< polls that fell back to the fixed delay */
+} ov2640_ready_stats_t;
+
+/**
+ * @brief ov2640 mismatch structure definition
+ */
+typedef struct ov2640_mismatch_s
+{
+    uint8_t bank;          /**< register bank */
+    uint8_t reg;           /**< register address */
+    uint8_t expect;        /**< table value */
+    uint8_t actual;        /**< read back value */
+} ov2640_mismatch_t;
+
+/**
+ * @brief ov2640 trace entry structure definition
+ */
+typedef struct ov2640_trace_entry_s
+{
+    uint32_t timestamp;        /**< time the bus call returned in us */
+    uint8_t bank;              /**< register bank, the bank select register is in the dsp bank */
+    uint8_t reg;               /**< register address */
+    uint8_t value;             /**< written or read value */
+    uint8_t flag;              /**< OV2640_TRACE_FLAG_* */
+} ov2640_trace_entry_t;
+
+/**
+ * @brief ov2640 perf enumeration definition
+ */
+typedef enum
+{
+    OV2640_PERF_INIT                 = 0x00,        /**< ov2640_init */
+    OV2640_PERF_WARM_INIT            = 0x01,        /**< ov2640_warm_init */
+    OV2640_PERF_DEINIT               = 0x02,        /**< ov2640_deinit */
+    OV2640_PERF_TABLE_INIT           = 0x03,        /**< ov2640_table_init */
+    OV2640_PERF_TABLE_JPEG_INIT      = 0x04,        /**< ov2640_table_jpeg_init */
+    OV2640_PERF_TABLE_RGB565_INIT    = 0x05,        /**< ov2640_table_rgb565_init */
+    OV2640_PERF_SOFT_RESET           = 0x06,        /**< ov2640_soft_reset */
+    OV2640_PERF_LIGHT_MODE           = 0x07,        /**< ov2640_set_light_mode */
+    OV2640_PERF_COLOR_SATURATION     = 0x08,        /**< ov2640_set_color_saturation */
+    OV2640_PERF_BRIGHTNESS           = 0x09,        /**< ov2640_set_brightness */
+    OV2640_PERF_CONTRAST             = 0x0A,        /**< ov2640_set_contrast */
+    OV2640_PERF_SPECIAL_EFFECT       = 0x0B,        /**< ov2640_set_special_effect */
+    OV2640_PERF_SWITCH_OUTPUT_FORMAT = 0x0C,        /**< ov2640_switch_output_format */
+    OV2640_PERF_WRITE_BATCH          = 0x0D,        /**< ov2640_write_batch */
+    OV2640_PERF_WRITE_TABLE          = 0x0E,        /**< ov2640_write_table */
+    OV2640_PERF_LOAD_SCRIPT          = 0x0F,        /**< ov2640_load_script */
+    OV2640_PERF_READ_BANK            = 0x10,        /**< ov2640_read_bank */
+    OV2640_PERF_TRANSACTION_COMMIT   = 0x11,        /**< ov2640_transaction_commit */
+    OV2640_PERF_QUEUE_FLUSH          = 0x12,        /**< ov2640_queue_flush */
+    OV2640_PERF_SAVE_SETTINGS        = 0x13,        /**< ov2640_save_settings */
+    OV2640_PERF_RESTORE_SETTINGS     = 0x14,        /**< ov2640_restore_settings */
+    OV2640_PERF_SCCB_READ            = 0x15,        /**< one sccb_read call */
+    OV2640_PERF_SCCB_WRITE           = 0x16,        /**< one sccb_write call */
+    OV2640_PERF_SCCB_TRANSFER        = 0x17,        /**< one sccb_transfer call */
+} ov2640_perf_t;
+
+/**
+ * @brief ov2640 perf stats structure definition
+ */
+typedef struct ov2640_perf_stats_s
+{
+    uint32_t count;                                  /**< timed calls */
+    uint32_t total_us;                               /**< sum of the call times in us, saturated */
+    uint32_t max_us;                                 /**< max call time in us */
+    uint16_t bucket[OV2640_PERF_BUCKET_MAX];         /**< call time histogram, saturated */
+} ov2640_perf_stats_t;
+
+/**
+ * @brief ov2640 state structure definition
+ */
+typedef struct ov2640_state_s
+{
+    uint8_t sensor_reg[0x63];                                      /**< sensor bank image 0x00 - 0x62 */
+    uint8_t dsp_reg[0xFC];                                         /**< dsp bank image 0x00 - 0xFB, only the decoded ranges are read */
+    uint16_t agc_gain;                                             /**< agc gain */
+    ov2640_dummy_frame_t dummy_frame;                              /**< dummy frame */
+    uint16_t vertical_window_line_start;                           /**< vertical window line start */
+    uint16_t vertical_window_line_end;                             /**< vertical window line end */
+    ov2640_bool_t horizontal_mirror;                               /**< horizontal mirror */
+    ov2640_bool_t vertical_flip;                                   /**< vertical flip */
+    uint16_t aec;                                                  /**< aec */
+    uint8_t frame_exposure_pre_charge_row_number;                  /**< frame exposure pre charge row number */
+    ov2640_mode_t mode;                                            /**< mode */
+    ov2640_bool_t power_reset_pin_remap;                           /**< power reset pin remap */
+    ov2640_output_drive_t output_drive;                            /**< output drive */
+    ov2640_band_t band;                                            /**< band */
+    ov2640_bool_t auto_band;                                       /**< auto band */
+    ov2640_bool_t live_video_after_snapshot;                       /**< live video after snapshot */
+    ov2640_pin_status_t clock_output_power_down_pin_status;        /**< clock output power down pin status */
+    ov2640_bool_t clock_rate_double;                               /**< clock rate double */
+    uint8_t clock_divider;                                         /**< clock divider */
+    ov2640_resolution_t resolution;                                /**< resolution */
+    ov2640_bool_t zoom;                                            /**< zoom */
+    ov2640_bool_t color_bar_test;                                  /**< color bar test */
+    ov2640_bool_t band_filter;                                     /**< band filter */
+    ov2640_control_t agc_control;                                  /**< agc control */
+    ov2640_control_t exposure_control;                             /**< exposure control */
+    ov2640_agc_gain_t agc_gain_ceiling;                            /**< agc gain ceiling */
+    ov2640_bool_t chsync_href_swap;                                /**< chsync href swap */
+    ov2640_bool_t href_chsync_swap;                                /**< href chsync swap */
+    ov2640_bool_t pclk_output_qualified_by_href;                   /**< pclk output qualified by href */
+    ov2640_edge_t pclk_edge;                                       /**< pclk edge */
+    ov2640_polarity_t href_polarity;                               /**< href polarity */
+    ov2640_polarity_t vsync_polarity;                              /**< vsync polarity */
+    ov2640_polarity_t hsync_polarity;                              /**< hsync polarity */
+    uint8_t luminance_signal_high_range;                           /**< luminance signal high range */
+    uint8_t luminance_signal_low_range;                            /**< luminance signal low range */
+    uint8_t fast_mode_large_step_range_high;                       /**< fast mode large step range high threshold */
+    uint8_t fast_mode_large_step_range_low;                        /**< fast mode large step range low threshold */
+    uint16_t line_interval_adjust;                                 /**< line interval adjust */
+    uint16_t hsync_position_and_width_end_point;                   /**< hsync position and width end point */
+    uint16_t hsync_position_and_width_start_point;                 /**< hsync position and width start point */
+    uint16_t vsync_pulse_width;                                    /**< vsync pulse width */
+    uint8_t luminance_average;                                     /**< luminance average */
+    uint16_t horizontal_window_start;                              /**< horizontal window start */
+    uint16_t horizontal_window_end;                                /**< horizontal window end */
+    ov2640_pclk_t pclk;                                            /**< pclk */
+    ov2640_bool_t zoom_window_horizontal_start_point;              /**< zoom window horizontal start point */
+    uint16_t frame_length_adjustment;                              /**< frame length adjustment */
+    uint16_t zoom_mode_vertical_window_start_point;                /**< zoom mode vertical window start point */
+    uint8_t flash_light;                                           /**< flash light */
+    uint16_t banding_aec_50hz;                                     /**< 50hz banding aec */
+    uint16_t banding_aec_60hz;                                     /**< 60hz banding aec */
+    uint32_t zone_average_weight_option;                           /**< 16 zone average weight option */
+    uint8_t histogram_algorithm_low_level;                         /**< histogram algorithm low level */
+    uint8_t histogram_algorithm_high_level;                        /**< histogram algorithm high level */
+    ov2640_bool_t dsp_bypass;                                      /**< dsp bypass */
+    ov2640_bool_t auto_mode;                                       /**< auto mode */
+    uint8_t dvp_pclk;                                              /**< dvp pclk */
+    ov2640_bool_t dvp_y8;                                          /**< dvp y8 */
+    ov2640_bool_t jpeg_output;                                     /**< jpeg output */
+    ov2640_dvp_output_format_t dvp_output_format;                  /**< dvp output format */
+    ov2640_href_timing_t dvp_jpeg_output_href_timing;              /**< dvp jpeg output href timing */
+    ov2640_byte_swap_t byte_swap;                                  /**< byte swap */
+    ov2640_bool_t reset[8];                                        /**< reset status indexed by ov2640_reset_t */
+    uint8_t sccb_master_speed;                                     /**< sccb master speed */
+    uint8_t sccb_slave_id;                                         /**< sccb slave id */
+    ov2640_bool_t address_auto_increase;                           /**< address auto increase */
+    ov2640_bool_t sccb;                                            /**< sccb */
+    ov2640_bool_t sccb_master_clock_delay;                         /**< sccb master clock delay */
+    ov2640_bool_t sccb_master_access;                              /**< sccb master access */
+    ov2640_bool_t sensor_pass_through_access;                      /**< sensor pass through access */
+    ov2640_bool_t bist[8];                                         /**< bist status indexed by ov2640_bist_t */
+    uint16_t program_memory_pointer_address;                       /**< program memory pointer address */
+    ov2640_bool_t cip;                                             /**< cip */
+    ov2640_bool_t dmy;                                             /**< dmy */
+    ov2640_bool_t raw_gma;                                         /**< raw gma */
+    ov2640_bool_t dg;                                              /**< dg */
+    ov2640_bool_t awb;                                             /**< awb */
+    ov2640_bool_t awb_gain;                                        /**< awb gain */
+    ov2640_bool_t lenc;                                            /**< lenc */
+    ov2640_bool_t pre;                                             /**< pre */
+    ov2640_bool_t aec_enable;                                      /**< aec enable */
+    ov2640_bool_t aec_sel;                                         /**< aec sel */
+    ov2640_bool_t stat_sel;                                        /**< stat sel */
+    ov2640_bool_t vfirst;                                          /**< vfirst */
+    ov2640_bool_t yuv422;                                          /**< yuv422 */
+    ov2640_bool_t yuv;                                             /**< yuv */
+    ov2640_bool_t rgb;                                             /**< rgb */
+    ov2640_bool_t raw;                                             /**< raw */
+    ov2640_bool_t dcw;                                             /**< dcw */
+    ov2640_bool_t sde;                                             /**< sde */
+    ov2640_bool_t uv_adj;                                          /**< uv adj */
+    ov2640_bool_t uv_avg;                                          /**< uv avg */
+    ov2640_bool_t cmx;                                             /**< cmx */
+    ov2640_bool_t bpc;                                             /**< bpc */
+    ov2640_bool_t wpc;                                             /**< wpc */
+    uint8_t sde_indirect_register_address;                         /**< sde indirect register address */
+    uint16_t image_horizontal;                                     /**< image horizontal */
+    uint16_t image_vertical;                                       /**< image vertical */
+    uint8_t quantization_scale_factor;                             /**< quantization scale factor */
+    ov2640_bool_t lp_dp;                                           /**< lp dp */
+    ov2640_bool_t round;                                           /**< round */
+    uint8_t vertical_divider;                                      /**< vertical divider */
+    uint8_t horizontal_divider;                                    /**< horizontal divider */
+    uint16_t horizontal_size;                                      /**< horizontal size */
+    uint16_t vertical_size;                                        /**< vertical size */
+    uint16_t offset_x;                                             /**< offset x */
+    uint16_t offset_y;                                             /**< offset y */
+    uint8_t dp_selx;                                               /**< dp selx */
+    uint8_t dp_sely;                                               /**< dp sely */
+    uint16_t output_width;                                         /**< output width */
+    uint16_t output_height;                                        /**< output height */
+    uint8_t zoom_speed;                                            /**< zoom speed */
+} ov2640_state_t;
+
 /**
  * @}
  */
@@ -330,6 +766,7 @@ typedef struct ov2640_handle_s
     uint8_t (*sccb_deinit)(void);                                                        /**< point to an sccb_deinit function address */
     uint8_t (*sccb_read)(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);         /**< point to an sccb_read function address */
     uint8_t (*sccb_write)(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);        /**< point to an sccb_write function address */
+    uint8_t (*sccb_transfer)(ov2640_sccb_segment_t *seg, uint16_t count);               /**< point to an sccb_transfer function address */
     uint8_t (*power_down_init)(void);                                                    /**< point to a power_down_init function address */
     uint8_t (*power_down_deinit)(void);                                                  /**< point to a power_down_deinit function address */
     uint8_t (*power_down_write)(uint8_t level);                                          /**< point to a power_down_write function address */
@@ -338,7 +775,75 @@ typedef struct ov2640_handle_s
     uint8_t (*reset_write)(uint8_t level);                                               /**< point to a reset_write function address */
     void (*delay_ms)(uint32_t ms);                                                       /**< point to a delay_ms function address */
     void (*debug_print)(const char *const fmt, ...);                                     /**< point to a debug_print function address */
+    void (*queue_callback)(ov2640_queue_op_t op, ov2640_bank_t bank,
+                           uint8_t reg, uint8_t data, uint8_t res);                      /**< point to a queue_callback function address */
+    uint32_t (*timestamp_us)(void);                                                      /**< point to a timestamp_us function address */
     uint8_t inited;                                                                      /**< inited flag */
+    uint8_t bank;                                                                        /**< cached bank */
+    uint8_t burst;                                                                       /**< burst write flag */
+    uint8_t auto_inc;                                                                    /**< address auto increase flag */
+    const ov2640_state_t *state;                                                         /**< snapshot being decoded */
+#if (OV2640_SHADOW_ENABLE == 1)
+    uint8_t shadow[2][256];                                                              /**< shadow register file */
+    uint8_t shadow_valid[2][32];                                                         /**< shadow valid bitmap */
+    uint8_t sde[OV2640_SETTINGS_SDE_MAX];                                                /**< sde indirect register shadow */
+    uint16_t sde_valid;                                                                  /**< sde indirect register valid bitmap */
+    uint8_t sde_addr;                                                                    /**< sde indirect address, 0xFF is unknown */
+#else
+    uint8_t last_bank;                                                                   /**< last accessed bank */
+    uint8_t last_reg;                                                                    /**< last accessed register */
+    uint8_t last_value;                                                                  /**< last accessed value */
+#endif
+    uint32_t skipped;                                                                    /**< skipped write counter */
+    uint8_t trans;                                                                       /**< transaction flag */
+    uint16_t stage_len;                                                                  /**< staged register count */
+    ov2640_batch_entry_t stage[OV2640_TRANSACTION_MAX];                                  /**< staged registers */
+    uint8_t queue_mode;                                                                  /**< queue mode flag */
+    uint16_t queue_head;                                                                 /**< queue head index */
+    uint16_t queue_len;                                                                  /**< queued operation count */
+    ov2640_queue_entry_t queue[OV2640_QUEUE_MAX];                                        /**< queued operations */
+    ov2640_transfer_t *transfer;                                                         /**< active transfer collector */
+#if (OV2640_TRANSFER_ENABLE == 1)
+    ov2640_transfer_t collector;                                                         /**< sccb transfer collector */
+#endif
+    uint8_t format;                                                                      /**< last loaded output format table */
+    uint8_t retry;                                                                       /**< retry times */
+    uint16_t retry_delay;                                                                /**< first retry delay in ms */
+    uint16_t retry_delay_max;                                                            /**< max retry delay in ms */
+    uint32_t fail_attempt;                                                               /**< failed attempt counter */
+    uint32_t retry_total;                                                                /**< retry counter */
+    uint32_t fail_final;                                                                 /**< unrecovered failure counter */
+    uint8_t last_fail_bank;                                                              /**< last failing bank */
+    uint8_t last_fail_reg;                                                               /**< last failing register */
+    uint8_t port_addr[4];                                                                /**< indirect address of the data ports */
+    uint8_t port_valid;                                                                  /**< indirect address valid bitmap */
+    uint32_t bus_reads;                                                                  /**< read transaction counter */
+    uint32_t bus_writes;                                                                 /**< write transaction counter */
+    uint32_t bus_bank_switches;                                                          /**< bank switch counter */
+    uint32_t bus_bytes;                                                                  /**< data byte counter */
+    uint32_t bus_failures;                                                               /**< failed bus call counter */
+    uint32_t bus_us;                                                                     /**< bus time counter in us */
+#if (OV2640_FAIL_COUNT_ENABLE == 1)
+    uint8_t fail_count[2][256];                                                          /**< per register failure counters */
+#endif
+    uint16_t ready_timeout;                                                              /**< ready polling timeout in ms */
+    uint16_t ready_last;                                                                 /**< last ready time in ms */
+    uint16_t ready_max;                                                                  /**< max ready time in ms */
+    uint32_t ready_waits;                                                                /**< ready wait counter */
+    uint32_t ready_timeouts;                                                             /**< ready polling timeout counter */
+    uint8_t verify;                                                                      /**< table verify flag */
+    ov2640_mismatch_t *verify_list;                                                      /**< mismatch list */
+    uint16_t verify_len;                                                                 /**< mismatch list length */
+    uint16_t verify_count;                                                               /**< mismatch counter */
+#if (OV2640_TRACE_ENABLE == 1)
+    ov2640_trace_entry_t *trace;                                                         /**< trace ring buffer */
+    uint16_t trace_len;                                                                  /**< trace ring length */
+    uint16_t trace_head;                                                                 /**< next trace entry */
+    uint32_t trace_total;                                                                /**< recorded trace entries */
+#endif
+#if (OV2640_PERF_ENABLE == 1)
+    ov2640_perf_stats_t perf[OV2640_PERF_MAX];                                           /**< latency histograms */
+#endif
 } ov2640_handle_t;
 
 /**
@@ -408,6 +913,14 @@ typedef struct ov2640_info_s
  */
 #define DRIVER_OV2640_LINK_SCCB_WRITE(HANDLE, FUC)               (HANDLE)->sccb_write = FUC
 
+/**
+ * @brief     link sccb_transfer function
+ * @param[in] HANDLE pointer to an ov2640 handle structure
+ * @param[in] FUC pointer to an sccb_transfer function address
+ * @note      the function is optional, sccb_read and sccb_write are used when it is NULL
+ */
+#define DRIVER_OV2640_LINK_SCCB_TRANSFER(HANDLE, FUC)            (HANDLE)->sccb_transfer = FUC
+
 /**
  * @brief     link power_down_init function
  * @param[in] HANDLE pointer to an ov2640 handle structure
@@ -472,6 +985,23 @@ typedef struct ov2640_info_s
  */
 #define DRIVER_OV2640_LINK_DEBUG_PRINT(HANDLE, FUC)              (HANDLE)->debug_print = FUC
 
+/**
+ * @brief     link queue_callback function
+ * @param[in] HANDLE pointer to an ov2640 handle structure
+ * @param[in] FUC pointer to a queue_callback function address
+ * @note      the callback is optional
+ */
+#define DRIVER_OV2640_LINK_QUEUE_CALLBACK(HANDLE, FUC)           (HANDLE)->queue_callback = FUC
+
+/**
+ * @brief     link timestamp_us function
+ * @param[in] HANDLE pointer to an ov2640 handle structure
+ * @param[in] FUC pointer to a timestamp_us function address
+ * @note      the timestamp is optional, it is a free running us counter that may wrap,
+ *            the trace and the latency histograms need it for the time
+ */
+#define DRIVER_OV2640_LINK_TIMESTAMP_US(HANDLE, FUC)             (HANDLE)->timestamp_us = FUC
+
 /**
  * @}
  */
@@ -510,6 +1040,30 @@ uint8_t ov2640_info(ov2640_info_t *info);
  */
 uint8_t ov2640_init(ov2640_handle_t *handle);
 
+/**
+ * @brief     initialize the chip without a reset
+ * @param[in] *handle pointer to an ov2640 handle structure
+ * @param[in] *keys pointer to a key register buffer
+ * @param[in] count key register count
+ * @param[in] checksum expected key register checksum
+ * @return    status code
+ *            - 0 success
+ *            - 1 sccb initialization failed
+ *            - 2 handle is NULL
+ *            - 3 linked functions is NULL
+ *            - 4 gpio init failed
+ *            - 5 gpio write failed
+ *            - 6 key registers are invalid
+ *            - 7 manufacturer id is invalid
+ *            - 8 product id is invalid
+ *            - 9 register state is not intact
+ * @note      for a sensor that kept its power while the mcu restarted,
+ *            the power down and reset pins are released without the reset delays and no soft reset is sent,
+ *            checksum comes from ov2640_get_register_checksum after the last configuration,
+ *            on any error the interfaces are deinitialized and ov2640_init must be run
+ */
+uint8_t ov2640_warm_init(ov2640_handle_t *handle, const ov2640_key_register_t *keys, uint16_t count, uint16_t checksum);
+
 /**
  * @brief     close the chip
  * @param[in] *handle pointer to an ov2640 handle structure
@@ -532,7 +1086,8 @@ uint8_t ov2640_deinit(ov2640_handle_t *handle);
  *            - 1 table init failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 4 table verify failed
+ * @note      with the table verify enabled the registers are read back and compared after the write
  */
 uint8_t ov2640_table_init(ov2640_handle_t *handle);
 
@@ -544,7 +1099,8 @@ uint8_t ov2640_table_init(ov2640_handle_t *handle);
  *            - 1 table jpeg init failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 4 table verify failed
+ * @note      with the table verify enabled the registers are read back and compared after the write
  */
 uint8_t ov2640_table_jpeg_init(ov2640_handle_t *handle);
 
@@ -556,7 +1112,8 @@ uint8_t ov2640_table_jpeg_init(ov2640_handle_t *handle);
  *            - 1 table rgb565 init failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 4 table verify failed
+ * @note      with the table verify enabled the registers are read back and compared after the write
  */
 uint8_t ov2640_table_rgb565_init(ov2640_handle_t *handle);
 
@@ -3633,6 +4190,25 @@ uint8_t ov2640_set_contrast(ov2640_handle_t *handle, ov2640_contrast_t contrast)
  */
 uint8_t ov2640_set_special_effect(ov2640_handle_t *handle, ov2640_special_effect_t effect);
 
+/**
+ * @brief     switch the output format
+ * @param[in] *handle pointer to an ov2640 handle structure
+ * @param[in] format target output format
+ * @return    status code
+ *            - 0 success
+ *            - 1 switch output format failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 table verify failed
+ * @note      only the registers that differ from the current state are written,
+ *            the whole format table is written when the current format is unknown,
+ *            a write to a register of a format table makes the current format unknown,
+ *            the verify compares the whole format table,
+ *            with the shadow register file the format table loaders skip the same registers,
+ *            so the switch only saves bus time when OV2640_SHADOW_ENABLE is 0
+ */
+uint8_t ov2640_switch_output_format(ov2640_handle_t *handle, ov2640_output_format_t format);
+
 /**
  * @}
  */
@@ -3668,7 +4244,7 @@ uint8_t ov2640_set_dsp_reg(ov2640_handle_t *handle, uint8_t reg, uint8_t data);
  *             - 1 get dsp failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note       none
+ * @note       the register is always read from the bus
  */
 uint8_t ov2640_get_dsp_reg(ov2640_handle_t *handle, uint8_t reg, uint8_t *data);
 
@@ -3696,10 +4272,511 @@ uint8_t ov2640_set_sensor_reg(ov2640_handle_t *handle, uint8_t reg, uint8_t data
  *             - 1 get sensor failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note       none
+ * @note       the register is always read from the bus
  */
 uint8_t ov2640_get_sensor_reg(ov2640_handle_t *handle, uint8_t reg, uint8_t *data);
 
+/**
+ * @brief     write batch
+ * @param[in] *handle pointer to an ov2640 handle structure
+ * @param[in] *entries pointer to a batch entry buffer
+ * @param[in] count batch entry count
+ * @return    status code
+ *            - 0 success
+ *            - 1 write batch failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 bank is invalid
+ *            - 5 reg is ra_dlmt
+ * @note      the port and self-updating registers are written in place in the order of the entries,
+ *            the entries between two of them are grouped by bank with one ra_dlmt switch per group
+ *            and masked writes to the same register are merged into one read modify write,
+ *            no write is moved or merged across a port or self-updating register,
+ *            entries with a zero mask are skipped, entries must not be NULL when count is not 0
+ */
+uint8_t ov2640_write_batch(ov2640_handle_t *handle, const ov2640_batch_entry_t *entries, uint16_t count);
+
+/**
+ * @brief     write an encoded register table
+ * @param[in] *handle pointer to an ov2640 handle structure
+ * @param[in] *table pointer to an encoded register table
+ * @param[in] len table length
+ * @return    status code
+ *            - 0 success
+ *            - 1 write table failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 table verify failed
+ * @note      the registers are written in the table order and collected into bursts,
+ *            the output format is unknown after the table
+ */
+uint8_t ov2640_write_table(ov2640_handle_t *handle, const uint8_t *table, uint16_t len);
+
+/**
+ * @brief     load a register script
+ * @param[in] *handle pointer to an ov2640 handle structure
+ * @param[in] *buf pointer to a script buffer
+ * @param[in] len buffer length
+ * @return    status code
+ *            - 0 success
+ *            - 1 load script failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 script header is invalid
+ *            - 5 script version is not supported
+ *            - 6 script crc is invalid
+ *            - 7 script body is invalid
+ * @note      the header, the crc and the body are checked before the first register is written,
+ *            the registers are written in the script order through the batch write,
+ *            the output format is unknown after the script
+ */
+uint8_t ov2640_load_script(ov2640_handle_t *handle, const uint8_t *buf, uint16_t len);
+
+/**
+ * @brief     enable or disable the burst write
+ * @param[in] *handle pointer to an ov2640 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 1 set burst write failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      consecutive registers of the tables and the batches are sent in one transaction,
+ *            enabling the burst write also enables the address auto increase,
+ *            it is enabled again before the next burst if it is turned off later
+ */
+uint8_t ov2640_set_burst_write(ov2640_handle_t *handle, ov2640_bool_t enable);
+
+/**
+ * @brief      get the burst write status
+ * @param[in]  *handle pointer to an ov2640 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t ov2640_get_burst_write(ov2640_handle_t *handle, ov2640_bool_t *enable);
+
+/**
+ * @brief      read a register bank range
+ * @param[in]  *handle pointer to an ov2640 handle structure
+ * @param[in]  bank register bank
+ * @param[in]  start first register address
+ * @param[in]  len register length
+ * @param[out] *buf pointer to a data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read bank failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 bank is invalid
+ *             - 5 len is invalid
+ * @note       the range is read in one transaction with the address auto increase,
+ *             reading an indirect data port range moves its address
+ */
+uint8_t ov2640_read_bank(ov2640_handle_t *handle, ov2640_bank_t bank, uint8_t start, uint16_t len, uint8_t *buf);
+
+/**
+ * @brief      get the chip state
+ * @param[in]  *handle pointer to an ov2640 handle structure
+ * @param[out] *state pointer to an ov2640 state structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get state failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the registers are fetched with four bulk reads and decoded without more bus traffic,
+ *             the indirect data ports and the sccb protocol registers are not part of the state
+ */
+uint8_t ov2640_get_state(ov2640_handle_t *handle, ov2640_state_t *state);
+
+/**
+ * @brief      get the skipped write counter
+ * @param[in]  *handle pointer to an ov2640 handle structure
+ * @param[out] *count pointer to a counter buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       a write is skipped when the register is known to hold the value already
+ */
+uint8_t ov2640_get_skipped_write_count(ov2640_handle_t *handle, uint32_t *count);
+
+/**
+ * @brief     clear the skipped write counter
+ * @param[in] *handle pointer to an ov2640 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t ov2640_clear_skipped_write_count(ov2640_handle_t *handle);
+
+/**
+ * @brief     begin a configuration transaction
+ * @param[in] *handle pointer to an ov2640 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 transaction is already open
+ * @note      register writes of the following setters are staged and merged per register,
+ *            reads see the staged values, reset and bank control writes flush the stage first
+ */
+uint8_t ov2640_transaction_begin(ov2640_handle_t *handle);
+
+/**
+ * @brief     commit a configuration transaction
+ * @param[in] *handle pointer to an ov2640 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 commit failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 transaction is not open
+ * @note      every staged register is written once, consecutive registers as bursts,
+ *            the transaction is closed even if the commit fails
+ */
+uint8_t ov2640_transaction_commit(ov2640_handle_t *handle);
+
+/**
+ * @brief     enable or disable the queue mode
+ * @param[in] *handle pointer to an ov2640 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 1 set queue mode failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      in the queue mode setter writes are put into the queue and sent by ov2640_queue_step,
+ *            reset, bank control and volatile registers are still written at once after the queue,
+ *            disabling the queue mode runs all queued operations first
+ */
+uint8_t ov2640_set_queue_mode(ov2640_handle_t *handle, ov2640_bool_t enable);
+
+/**
+ * @brief      get the queue mode status
+ * @param[in]  *handle pointer to an ov2640 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t ov2640_get_queue_mode(ov2640_handle_t *handle, ov2640_bool_t *enable);
+
+/**
+ * @brief     queue a register read
+ * @param[in] *handle pointer to an ov2640 handle structure
+ * @param[in] bank register bank
+ * @param[in] reg register address
+ * @return    status code
+ *            - 0 success
+ *            - 1 queue read failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 bank is invalid
+ * @note      the value is reported to the queue callback when the read is run
+ */
+uint8_t ov2640_queue_read(ov2640_handle_t *handle, ov2640_bank_t bank, uint8_t reg);
+
+/**
+ * @brief      run one queued operation
+ * @param[in]  *handle pointer to an ov2640 handle structure
+ * @param[out] *pending pointer to a pending operation count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 queue step failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       call it from the main loop until pending is 0, an empty queue does nothing,
+ *             a failed operation is dropped after it is reported to the queue callback
+ */
+uint8_t ov2640_queue_step(ov2640_handle_t *handle, uint16_t *pending);
+
+/**
+ * @brief     run all queued operations
+ * @param[in] *handle pointer to an ov2640 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 queue flush failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      it blocks until the queue is empty or an operation fails
+ */
+uint8_t ov2640_queue_flush(ov2640_handle_t *handle);
+
+/**
+ * @brief     set the bus retry
+ * @param[in] *handle pointer to an ov2640 handle structure
+ * @param[in] times retry times
+ * @param[in] delay_ms first retry delay in ms
+ * @param[in] max_delay_ms max retry delay in ms
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 delay_ms is over max_delay_ms
+ * @note      the delay doubles after every failed attempt up to max_delay_ms,
+ *            it can be called before ov2640_init so that the init is retried too,
+ *            times 0 disables the retry
+ */
+uint8_t ov2640_set_retry(ov2640_handle_t *handle, uint8_t times, uint16_t delay_ms, uint16_t max_delay_ms);
+
+/**
+ * @brief      get the bus retry
+ * @param[in]  *handle pointer to an ov2640 handle structure
+ * @param[out] *times pointer to a retry times buffer
+ * @param[out] *delay_ms pointer to a first retry delay buffer
+ * @param[out] *max_delay_ms pointer to a max retry delay buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ * @note       none
+ */
+uint8_t ov2640_get_retry(ov2640_handle_t *handle, uint8_t *times, uint16_t *delay_ms, uint16_t *max_delay_ms);
+
+/**
+ * @brief      get the bus error stats
+ * @param[in]  *handle pointer to an ov2640 handle structure
+ * @param[out] *stats pointer to an ov2640 error stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       a failed sccb_transfer call is counted for its first register when the retry is disabled
+ */
+uint8_t ov2640_get_error_stats(ov2640_handle_t *handle, ov2640_error_stats_t *stats);
+
+/**
+ * @brief      get the failure count of a register
+ * @param[in]  *handle pointer to an ov2640 handle structure
+ * @param[in]  bank register bank
+ * @param[in]  reg register address
+ * @param[out] *count pointer to a failure count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 failure counters are disabled
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 bank is invalid
+ * @note       the count saturates at 255, the bank select register is counted in the dsp bank
+ */
+uint8_t ov2640_get_register_failure_count(ov2640_handle_t *handle, ov2640_bank_t bank, uint8_t reg, uint8_t *count);
+
+/**
+ * @brief     clear the bus error stats
+ * @param[in] *handle pointer to an ov2640 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the per register failure counters are cleared too
+ */
+uint8_t ov2640_clear_error_stats(ov2640_handle_t *handle);
+
+/**
+ * @brief      get the key register checksum
+ * @param[in]  *handle pointer to an ov2640 handle structure
+ * @param[in]  *keys pointer to a key register buffer
+ * @param[in]  count key register count
+ * @param[out] *checksum pointer to a checksum buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get register checksum failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 key registers are invalid
+ * @note       the checksum is kept by the application for ov2640_warm_init
+ */
+uint8_t ov2640_get_register_checksum(ov2640_handle_t *handle, const ov2640_key_register_t *keys,
+                                     uint16_t count, uint16_t *checksum);
+
+/**
+ * @brief     set the ready polling
+ * @param[in] *handle pointer to an ov2640 handle structure
+ * @param[in] timeout_ms polling timeout in ms
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      0 disables the polling and keeps the fixed delays,
+ *            the chip is polled every 1ms after the reset release and the soft reset until pidh, pidl and com7 answer,
+ *            the fixed delay is still waited after a timeout, the setting is kept by ov2640_init
+ */
+uint8_t ov2640_set_ready_polling(ov2640_handle_t *handle, uint16_t timeout_ms);
+
+/**
+ * @brief      get the ready polling
+ * @param[in]  *handle pointer to an ov2640 handle structure
+ * @param[out] *timeout_ms pointer to a polling timeout buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ * @note       none
+ */
+uint8_t ov2640_get_ready_polling(ov2640_handle_t *handle, uint16_t *timeout_ms);
+
+/**
+ * @brief      get the ready stats
+ * @param[in]  *handle pointer to an ov2640 handle structure
+ * @param[out] *stats pointer to a ready stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ * @note       the ready time is the polled time or the fixed delay, the stats are cleared by ov2640_init
+ */
+uint8_t ov2640_get_ready_stats(ov2640_handle_t *handle, ov2640_ready_stats_t *stats);
+
+/**
+ * @brief     set the table verify
+ * @param[in] *handle pointer to an ov2640 handle structure
+ * @param[in] enable bool value
+ * @param[in] *list pointer to a mismatch list, it can be NULL
+ * @param[in] len list length
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      the table loaders read the written registers back in bursts and compare them with the table,
+ *            registers that change by themselves are skipped, the first len mismatches are saved to the list,
+ *            the setting is kept by ov2640_init
+ */
+uint8_t ov2640_set_table_verify(ov2640_handle_t *handle, ov2640_bool_t enable, ov2640_mismatch_t *list, uint16_t len);
+
+/**
+ * @brief      get the table verify
+ * @param[in]  *handle pointer to an ov2640 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ * @note       none
+ */
+uint8_t ov2640_get_table_verify(ov2640_handle_t *handle, ov2640_bool_t *enable);
+
+/**
+ * @brief      get the mismatch count of the last table verify
+ * @param[in]  *handle pointer to an ov2640 handle structure
+ * @param[out] *count pointer to a count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ * @note       the count can be larger than the list length
+ */
+uint8_t ov2640_get_table_mismatch_count(ov2640_handle_t *handle, uint16_t *count);
+
+/**
+ * @brief      save the settings
+ * @param[in]  *handle pointer to an ov2640 handle structure
+ * @param[out] *blob pointer to a blob buffer
+ * @param[in]  len buffer length
+ * @return     status code
+ *             - 0 success
+ *             - 1 save settings failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 buffer is too small
+ * @note       the blob is OV2640_SETTINGS_SIZE bytes, registers already known by the driver are not read again,
+ *             the gain, the exposure and the other registers that change by themselves are not saved
+ */
+uint8_t ov2640_save_settings(ov2640_handle_t *handle, uint8_t *blob, uint16_t len);
+
+/**
+ * @brief     restore the settings
+ * @param[in] *handle pointer to an ov2640 handle structure
+ * @param[in] *blob pointer to a blob buffer
+ * @param[in] len buffer length
+ * @return    status code
+ *            - 0 success
+ *            - 1 restore settings failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 blob is invalid
+ *            - 5 blob crc is invalid
+ * @note      the blob is compared with the chip and only the changed registers are written,
+ *            the dvp is not held in reset, stop the output before a blob with another image size is restored
+ */
+uint8_t ov2640_restore_settings(ov2640_handle_t *handle, const uint8_t *blob, uint16_t len);
+
+/**
+ * @brief     set the bus trace
+ * @param[in] *handle pointer to an ov2640 handle structure
+ * @param[in] *buf pointer to a trace ring buffer, NULL stops the trace
+ * @param[in] len ring length
+ * @return    status code
+ *            - 0 success
+ *            - 1 trace is disabled
+ *            - 2 handle is NULL
+ * @note      every bus transaction is recorded, the oldest entries are overwritten when the ring is full,
+ *            the trace is kept by ov2640_init so that the init can be recorded, link timestamp_us for the time
+ */
+uint8_t ov2640_set_trace(ov2640_handle_t *handle, ov2640_trace_entry_t *buf, uint16_t len);
+
+/**
+ * @brief      get the bus trace
+ * @param[in]  *handle pointer to an ov2640 handle structure
+ * @param[out] *first pointer to an oldest entry index buffer
+ * @param[out] *count pointer to an entry count buffer
+ * @param[out] *total pointer to a recorded entry count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 trace is disabled
+ *             - 2 handle is NULL
+ * @note       the entries in time order are buf[(first + i) % len] for i < count, total - count entries were overwritten
+ */
+uint8_t ov2640_get_trace(ov2640_handle_t *handle, uint16_t *first, uint16_t *count, uint32_t *total);
+
+/**
+ * @brief     mark a phase in the bus trace
+ * @param[in] *handle pointer to an ov2640 handle structure
+ * @param[in] id mark id
+ * @return    status code
+ *            - 0 success
+ *            - 1 trace is disabled
+ *            - 2 handle is NULL
+ * @note      the replay tool splits the trace at the marks and reports every phase
+ */
+uint8_t ov2640_trace_mark(ov2640_handle_t *handle, uint8_t id);
+
+/**
+ * @brief      get the latency histogram
+ * @param[in]  *handle pointer to an ov2640 handle structure
+ * @param[in]  perf timed api or bus call
+ * @param[out] *stats pointer to an ov2640 perf stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 latency histograms are disabled
+ *             - 2 handle is NULL
+ *             - 4 perf is invalid
+ * @note       calls are only timed when timestamp_us is linked, the histograms are kept by ov2640_init
+ */
+uint8_t ov2640_get_perf_stats(ov2640_handle_t *handle, ov2640_perf_t perf, ov2640_perf_stats_t *stats);
+
+/**
+ * @brief     clear the latency histograms
+ * @param[in] *handle pointer to an ov2640 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 latency histograms are disabled
+ *            - 2 handle is NULL
+ * @note      none
+ */
+uint8_t ov2640_clear_perf_stats(ov2640_handle_t *handle);
+
+/**
+ * @brief      get the bus stats
+ * @param[in]  *handle pointer to an ov2640 handle structure
+ * @param[out] *stats pointer to an ov2640 bus stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ * @note       the counters are kept by ov2640_init and wrap, take the difference of two reads,
+ *             the bus time needs timestamp_us
+ */
+uint8_t ov2640_get_bus_stats(ov2640_handle_t *handle, ov2640_bus_stats_t *stats);
+
 /**
  * @}
  */
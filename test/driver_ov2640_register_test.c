@@ -37,7 +37,9 @@
 #include "driver_ov2640_register_test.h"
 #include <stdlib.h>
 
-static ov2640_handle_t gs_handle;        /**< ov2640 handle */
+static ov2640_handle_t gs_handle;                  /**< ov2640 handle */
+static ov2640_state_t gs_state;                    /**< ov2640 state */
+static uint8_t gs_settings[OV2640_SETTINGS_SIZE];  /**< ov2640 settings */
 
 /**
  * @brief  register test
@@ -62,6 +64,7 @@ uint8_t ov2640_register_test(void)
     ov2640_info_t info;
     ov2640_dummy_frame_t dummy_frame;
     ov2640_bool_t enable;
+    ov2640_bool_t enable_check;
     ov2640_mode_t mode;
     ov2640_output_drive_t drive;
     ov2640_band_t band;
@@ -75,6 +78,26 @@ uint8_t ov2640_register_test(void)
     ov2640_dvp_output_format_t format;
     ov2640_href_timing_t timing;
     ov2640_byte_swap_t byte_swap;
+    ov2640_batch_entry_t entries[3];
+    uint8_t table[8];
+    uint8_t script[17];
+    uint8_t i;
+    uint8_t j;
+    uint16_t checksum;
+    uint16_t checksum_check;
+    ov2640_key_register_t keys[2];
+    ov2640_ready_stats_t ready_stats;
+    ov2640_mismatch_t mismatch[4];
+    uint8_t buf[2];
+    uint16_t max_delay;
+    ov2640_error_stats_t error_stats;
+    ov2640_trace_entry_t trace[8];
+    uint16_t first;
+    uint16_t count;
+    uint32_t total;
+    ov2640_perf_stats_t perf;
+    ov2640_bus_stats_t bus_stats;
+    ov2640_bus_stats_t bus_stats_check;
 
     /* link interface function */
     DRIVER_OV2640_LINK_INIT(&gs_handle, ov2640_handle_t);
@@ -90,6 +113,7 @@ uint8_t ov2640_register_test(void)
     DRIVER_OV2640_LINK_RESET_WRITE(&gs_handle, ov2640_interface_reset_write);
     DRIVER_OV2640_LINK_DELAY_MS(&gs_handle, ov2640_interface_delay_ms);
     DRIVER_OV2640_LINK_DEBUG_PRINT(&gs_handle, ov2640_interface_debug_print);
+    DRIVER_OV2640_LINK_TIMESTAMP_US(&gs_handle, ov2640_interface_timestamp_us);
     
     /* get information */
     res = ov2640_info(&info);
@@ -4185,6 +4209,16 @@ uint8_t ov2640_register_test(void)
         return 1;
     }
     ov2640_interface_debug_print("ov2640: set sde indirect register data %d.\n", reg8);
+    
+    /* the address increases on a data write */
+    res = ov2640_set_sde_indirect_register_address(&gs_handle, 0x00);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: set sde indirect register address failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
     res = ov2640_get_sde_indirect_register_data(&gs_handle, &reg8_check);
     if (res != 0)
     {
@@ -4933,6 +4967,1006 @@ uint8_t ov2640_register_test(void)
     }
     ov2640_interface_debug_print("ov2640: check special effect normal %s.\n", res == 0 ? "ok" : "error");
     
+    /* ov2640_set_burst_write/ov2640_get_burst_write test */
+    ov2640_interface_debug_print("ov2640: ov2640_set_burst_write/ov2640_get_burst_write test.\n");
+    
+    /* enable burst write */
+    res = ov2640_set_burst_write(&gs_handle, OV2640_BOOL_TRUE);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: set burst write failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ov2640_interface_debug_print("ov2640: enable burst write.\n");
+    res = ov2640_get_burst_write(&gs_handle, &enable);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: get burst write failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ov2640_interface_debug_print("ov2640: check burst write %s.\n", enable == OV2640_BOOL_TRUE ? "ok" : "error");
+    
+    /* disable burst write */
+    res = ov2640_set_burst_write(&gs_handle, OV2640_BOOL_FALSE);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: set burst write failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ov2640_interface_debug_print("ov2640: disable burst write.\n");
+    res = ov2640_get_burst_write(&gs_handle, &enable);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: get burst write failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ov2640_interface_debug_print("ov2640: check burst write %s.\n", enable == OV2640_BOOL_FALSE ? "ok" : "error");
+    
+    /* ov2640_write_batch test */
+    ov2640_interface_debug_print("ov2640: ov2640_write_batch test.\n");
+    
+    /* write batch */
+    reg8 = rand() % 0xFF;
+    reg16 = rand() % 0xFF;
+    entries[0].bank = OV2640_BANK_DSP;
+    entries[0].reg = 0x5A;
+    entries[0].mask = 0x0F;
+    entries[0].value = reg8;
+    entries[1].bank = OV2640_BANK_SENSOR;
+    entries[1].reg = 0x4F;
+    entries[1].mask = 0xFF;
+    entries[1].value = (uint8_t)reg16;
+    entries[2].bank = OV2640_BANK_DSP;
+    entries[2].reg = 0x5A;
+    entries[2].mask = 0xF0;
+    entries[2].value = reg8;
+    res = ov2640_write_batch(&gs_handle, entries, 3);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: write batch failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ov2640_interface_debug_print("ov2640: write batch 0x%02X 0x%02X.\n", reg8, reg16);
+    res = ov2640_get_dsp_reg(&gs_handle, 0x5A, &reg8_check);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: get dsp reg failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ov2640_interface_debug_print("ov2640: check dsp batch %s.\n", reg8 == reg8_check ? "ok" : "error");
+    res = ov2640_get_sensor_reg(&gs_handle, 0x4F, &reg8_check);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: get sensor reg failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ov2640_interface_debug_print("ov2640: check sensor batch %s.\n", reg16 == reg8_check ? "ok" : "error");
+    
+    /* write batch without entries */
+    res = ov2640_write_batch(&gs_handle, NULL, 1);
+    ov2640_interface_debug_print("ov2640: check null batch %s.\n", res == 1 ? "ok" : "error");
+    res = ov2640_write_batch(&gs_handle, NULL, 0);
+    ov2640_interface_debug_print("ov2640: check empty batch %s.\n", res == 0 ? "ok" : "error");
+    
+    /* ov2640_write_table test */
+    ov2640_interface_debug_print("ov2640: ov2640_write_table test.\n");
+    
+    /* write table */
+    reg8 = rand() % 0xFF;
+    reg16 = rand() % 0xFF;
+    table[0] = OV2640_CODE_BANK | OV2640_BANK_DSP;
+    table[1] = OV2640_CODE_PAIR | 0;
+    table[2] = 0x5A;
+    table[3] = reg8;
+    table[4] = OV2640_CODE_BANK | OV2640_BANK_SENSOR;
+    table[5] = OV2640_CODE_PAIR | 0;
+    table[6] = 0x4F;
+    table[7] = (uint8_t)reg16;
+    res = ov2640_write_table(&gs_handle, table, 8);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: write table failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ov2640_interface_debug_print("ov2640: write table 0x%02X 0x%02X.\n", reg8, reg16);
+    res = ov2640_get_dsp_reg(&gs_handle, 0x5A, &reg8_check);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: get dsp reg failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ov2640_interface_debug_print("ov2640: check dsp table %s.\n", reg8 == reg8_check ? "ok" : "error");
+    res = ov2640_get_sensor_reg(&gs_handle, 0x4F, &reg8_check);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: get sensor reg failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ov2640_interface_debug_print("ov2640: check sensor table %s.\n", reg16 == reg8_check ? "ok" : "error");
+    
+    /* ov2640_load_script test */
+    ov2640_interface_debug_print("ov2640: ov2640_load_script test.\n");
+    
+    /* load script */
+    reg8 = rand() % 0xFF;
+    reg16 = rand() % 0xFF;
+    script[0] = OV2640_SCRIPT_MAGIC0;
+    script[1] = OV2640_SCRIPT_MAGIC1;
+    script[2] = OV2640_SCRIPT_VERSION;
+    script[3] = 0;
+    script[4] = 0;
+    script[5] = 9;
+    script[8] = OV2640_CODE_BANK | OV2640_BANK_DSP;
+    script[9] = OV2640_CODE_PAIR | 0;
+    script[10] = 0x5A;
+    script[11] = reg8;
+    script[12] = OV2640_CODE_BANK | OV2640_BANK_SENSOR;
+    script[13] = OV2640_CODE_MASK;
+    script[14] = 0x4F;
+    script[15] = 0xFF;
+    script[16] = (uint8_t)reg16;
+    checksum = 0xFFFF;
+    for (i = 8; i < 17; i++)
+    {
+        checksum ^= (uint16_t)(script[i] << 8);
+        for (j = 0; j < 8; j++)
+        {
+            checksum = ((checksum & 0x8000) != 0) ? (uint16_t)((checksum << 1) ^ 0x1021) : (uint16_t)(checksum << 1);
+        }
+    }
+    script[6] = (checksum >> 8) & 0xFF;
+    script[7] = (~checksum) & 0xFF;
+    res = ov2640_load_script(&gs_handle, script, 17);
+    ov2640_interface_debug_print("ov2640: check script crc %s.\n", res == 6 ? "ok" : "error");
+    script[7] = (checksum >> 0) & 0xFF;
+    res = ov2640_load_script(&gs_handle, script, 17);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: load script failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ov2640_interface_debug_print("ov2640: load script 0x%02X 0x%02X.\n", reg8, reg16);
+    res = ov2640_get_dsp_reg(&gs_handle, 0x5A, &reg8_check);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: get dsp reg failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ov2640_interface_debug_print("ov2640: check dsp script %s.\n", reg8 == reg8_check ? "ok" : "error");
+    res = ov2640_get_sensor_reg(&gs_handle, 0x4F, &reg8_check);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: get sensor reg failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ov2640_interface_debug_print("ov2640: check sensor script %s.\n", reg16 == reg8_check ? "ok" : "error");
+    
+    /* ov2640_read_bank test */
+    ov2640_interface_debug_print("ov2640: ov2640_read_bank test.\n");
+    
+    /* read the manufacturer id */
+    res = ov2640_read_bank(&gs_handle, OV2640_BANK_SENSOR, 0x1C, 2, buf);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: read bank failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ov2640_interface_debug_print("ov2640: read bank 0x%02X 0x%02X.\n", buf[0], buf[1]);
+    ov2640_interface_debug_print("ov2640: check read bank %s.\n", ((buf[0] == 0x7F) && (buf[1] == 0xA2)) ? "ok" : "error");
+    
+    /* ov2640_get_state test */
+    ov2640_interface_debug_print("ov2640: ov2640_get_state test.\n");
+    
+    /* get state */
+    res = ov2640_get_state(&gs_handle, &gs_state);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: get state failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ov2640_get_output_width(&gs_handle, &reg16_check);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: get output width failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ov2640_interface_debug_print("ov2640: check state output width %s.\n", gs_state.output_width == reg16_check ? "ok" : "error");
+    res = ov2640_get_clock_divider(&gs_handle, &reg8_check);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: get clock divider failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ov2640_interface_debug_print("ov2640: check state clock divider %s.\n", gs_state.clock_divider == reg8_check ? "ok" : "error");
+    
+    /* ov2640_get_skipped_write_count test */
+    ov2640_interface_debug_print("ov2640: ov2640_get_skipped_write_count test.\n");
+    
+    /* clear skipped write count */
+    res = ov2640_clear_skipped_write_count(&gs_handle);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: clear skipped write count failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ov2640_set_awb(&gs_handle, OV2640_BOOL_TRUE);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: set awb failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ov2640_set_awb(&gs_handle, OV2640_BOOL_TRUE);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: set awb failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ov2640_get_skipped_write_count(&gs_handle, &reg32);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: get skipped write count failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ov2640_interface_debug_print("ov2640: skipped write count is %d.\n", reg32);
+    ov2640_interface_debug_print("ov2640: check skipped write count %s.\n", reg32 >= 1 ? "ok" : "error");
+    
+    /* ov2640_transaction_begin/ov2640_transaction_commit test */
+    ov2640_interface_debug_print("ov2640: ov2640_transaction_begin/ov2640_transaction_commit test.\n");
+    
+    /* transaction begin */
+    res = ov2640_transaction_begin(&gs_handle);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: transaction begin failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ov2640_set_cip(&gs_handle, OV2640_BOOL_FALSE);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: set cip failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ov2640_set_dmy(&gs_handle, OV2640_BOOL_TRUE);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: set dmy failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ov2640_set_cip(&gs_handle, OV2640_BOOL_TRUE);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: set cip failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ov2640_transaction_commit(&gs_handle);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: transaction commit failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ov2640_get_cip(&gs_handle, &enable);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: get cip failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ov2640_interface_debug_print("ov2640: check transaction cip %s.\n", enable == OV2640_BOOL_TRUE ? "ok" : "error");
+    res = ov2640_get_dmy(&gs_handle, &enable);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: get dmy failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ov2640_interface_debug_print("ov2640: check transaction dmy %s.\n", enable == OV2640_BOOL_TRUE ? "ok" : "error");
+    
+    /* ov2640_set_queue_mode/ov2640_get_queue_mode test */
+    ov2640_interface_debug_print("ov2640: ov2640_set_queue_mode/ov2640_get_queue_mode test.\n");
+    
+    /* enable queue mode */
+    res = ov2640_set_queue_mode(&gs_handle, OV2640_BOOL_TRUE);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: set queue mode failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ov2640_interface_debug_print("ov2640: enable queue mode.\n");
+    res = ov2640_get_queue_mode(&gs_handle, &enable);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: get queue mode failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ov2640_interface_debug_print("ov2640: check queue mode %s.\n", enable == OV2640_BOOL_TRUE ? "ok" : "error");
+    
+    /* ov2640_queue_step test */
+    ov2640_interface_debug_print("ov2640: ov2640_queue_step test.\n");
+    
+    res = ov2640_set_cip(&gs_handle, OV2640_BOOL_FALSE);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: set cip failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ov2640_queue_read(&gs_handle, OV2640_BANK_DSP, 0xC3);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: queue read failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    do
+    {
+        res = ov2640_queue_step(&gs_handle, &reg16);
+        if (res != 0)
+        {
+            ov2640_interface_debug_print("ov2640: queue step failed.\n");
+            (void)ov2640_deinit(&gs_handle);
+            
+            return 1;
+        }
+    } while (reg16 != 0);
+    res = ov2640_get_cip(&gs_handle, &enable);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: get cip failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ov2640_interface_debug_print("ov2640: check queue cip %s.\n", enable == OV2640_BOOL_FALSE ? "ok" : "error");
+    
+    /* disable queue mode */
+    res = ov2640_set_queue_mode(&gs_handle, OV2640_BOOL_FALSE);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: set queue mode failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ov2640_interface_debug_print("ov2640: disable queue mode.\n");
+    
+    /* ov2640_set_retry/ov2640_get_retry test */
+    ov2640_interface_debug_print("ov2640: ov2640_set_retry/ov2640_get_retry test.\n");
+    
+    reg8 = rand() % 4 + 1;
+    reg16 = rand() % 5 + 1;
+    res = ov2640_set_retry(&gs_handle, reg8, reg16, reg16 * 8);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: set retry failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ov2640_interface_debug_print("ov2640: set retry %d times %dms.\n", reg8, reg16);
+    res = ov2640_get_retry(&gs_handle, &reg8_check, &reg16_check, &max_delay);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: get retry failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ov2640_interface_debug_print("ov2640: check retry %s.\n", (reg8 == reg8_check) && (reg16 == reg16_check) && (max_delay == reg16 * 8) ? "ok" : "error");
+    
+    /* ov2640_get_error_stats/ov2640_clear_error_stats test */
+    ov2640_interface_debug_print("ov2640: ov2640_get_error_stats/ov2640_clear_error_stats test.\n");
+    
+    res = ov2640_clear_error_stats(&gs_handle);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: clear error stats failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ov2640_get_error_stats(&gs_handle, &error_stats);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: get error stats failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ov2640_interface_debug_print("ov2640: check error stats %s.\n", (error_stats.failures == 0) && (error_stats.last_bank == 0xFF) ? "ok" : "error");
+    res = ov2640_get_register_failure_count(&gs_handle, OV2640_BANK_SENSOR, 0x12, &reg8);
+    if (res == 0)
+    {
+        ov2640_interface_debug_print("ov2640: check register failure count %s.\n", reg8 == 0 ? "ok" : "error");
+    }
+    else
+    {
+        ov2640_interface_debug_print("ov2640: register failure count is disabled.\n");
+    }
+    (void)ov2640_set_retry(&gs_handle, 0, 0, 0);
+    
+    /* ov2640_switch_output_format test */
+    ov2640_interface_debug_print("ov2640: ov2640_switch_output_format test.\n");
+    
+    /* jpeg */
+    res = ov2640_switch_output_format(&gs_handle, OV2640_OUTPUT_FORMAT_JPEG);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: switch output format failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ov2640_interface_debug_print("ov2640: switch output format jpeg.\n");
+    res = ov2640_get_jpeg_output(&gs_handle, &enable);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: get jpeg output failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ov2640_interface_debug_print("ov2640: check output format %s.\n", enable == OV2640_BOOL_TRUE ? "ok" : "error");
+    
+    /* rgb565 */
+    res = ov2640_switch_output_format(&gs_handle, OV2640_OUTPUT_FORMAT_RGB565);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: switch output format failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ov2640_interface_debug_print("ov2640: switch output format rgb565.\n");
+    res = ov2640_get_jpeg_output(&gs_handle, &enable);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: get jpeg output failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ov2640_interface_debug_print("ov2640: check output format %s.\n", enable == OV2640_BOOL_FALSE ? "ok" : "error");
+    
+    /* rgb565 after a format register is changed */
+    res = ov2640_set_dsp_reg(&gs_handle, 0xDA, 0x10);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: set dsp reg failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ov2640_set_brightness(&gs_handle, OV2640_BRIGHTNESS_0);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: set brightness failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ov2640_switch_output_format(&gs_handle, OV2640_OUTPUT_FORMAT_RGB565);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: switch output format failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ov2640_interface_debug_print("ov2640: switch output format rgb565 after a register write.\n");
+    res = ov2640_get_jpeg_output(&gs_handle, &enable);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: get jpeg output failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ov2640_interface_debug_print("ov2640: check output format %s.\n", enable == OV2640_BOOL_FALSE ? "ok" : "error");
+    
+    /* ov2640_get_register_checksum test */
+    ov2640_interface_debug_print("ov2640: ov2640_get_register_checksum test.\n");
+    
+    /* get register checksum */
+    keys[0].bank = OV2640_BANK_SENSOR;
+    keys[0].reg = 0x1C;
+    keys[0].mask = 0xFF;
+    keys[1].bank = OV2640_BANK_DSP;
+    keys[1].reg = 0x5A;
+    keys[1].mask = 0xFF;
+    res = ov2640_get_register_checksum(&gs_handle, keys, 2, &checksum);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: get register checksum failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ov2640_interface_debug_print("ov2640: register checksum 0x%04X.\n", checksum);
+    res = ov2640_get_register_checksum(&gs_handle, keys, 2, &checksum_check);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: get register checksum failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ov2640_interface_debug_print("ov2640: check register checksum %s.\n", checksum == checksum_check ? "ok" : "error");
+    
+    /* ov2640_set_ready_polling/ov2640_get_ready_polling test */
+    ov2640_interface_debug_print("ov2640: ov2640_set_ready_polling/ov2640_get_ready_polling test.\n");
+    
+    /* set ready polling */
+    reg16 = rand() % 100 + 1;
+    res = ov2640_set_ready_polling(&gs_handle, reg16);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: set ready polling failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ov2640_interface_debug_print("ov2640: set ready polling %d ms.\n", reg16);
+    res = ov2640_get_ready_polling(&gs_handle, &reg16_check);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: get ready polling failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ov2640_interface_debug_print("ov2640: check ready polling %s.\n", reg16 == reg16_check ? "ok" : "error");
+    
+    /* ov2640_get_ready_stats test */
+    ov2640_interface_debug_print("ov2640: ov2640_get_ready_stats test.\n");
+    
+    /* soft reset with the polling */
+    res = ov2640_soft_reset(&gs_handle);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: soft reset failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ov2640_get_ready_stats(&gs_handle, &ready_stats);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: get ready stats failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ov2640_interface_debug_print("ov2640: ready last %d ms, max %d ms, %d waits, %d timeouts.\n", ready_stats.last_ms,
+                                 ready_stats.max_ms, (int)ready_stats.waits, (int)ready_stats.timeouts);
+    ov2640_interface_debug_print("ov2640: check ready stats %s.\n", ready_stats.last_ms <= reg16 + 10 ? "ok" : "error");
+    res = ov2640_set_ready_polling(&gs_handle, 0);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: set ready polling failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* ov2640_set_table_verify/ov2640_get_table_verify test */
+    ov2640_interface_debug_print("ov2640: ov2640_set_table_verify/ov2640_get_table_verify test.\n");
+    
+    /* enable table verify */
+    res = ov2640_set_table_verify(&gs_handle, OV2640_BOOL_TRUE, mismatch, 4);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: set table verify failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ov2640_interface_debug_print("ov2640: enable table verify.\n");
+    res = ov2640_get_table_verify(&gs_handle, &enable);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: get table verify failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ov2640_interface_debug_print("ov2640: check table verify %s.\n", enable == OV2640_BOOL_TRUE ? "ok" : "error");
+    
+    /* ov2640_get_table_mismatch_count test */
+    ov2640_interface_debug_print("ov2640: ov2640_get_table_mismatch_count test.\n");
+    
+    /* table init with the verify */
+    res = ov2640_table_init(&gs_handle);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: table init failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ov2640_get_table_mismatch_count(&gs_handle, &reg16);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: get table mismatch count failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ov2640_interface_debug_print("ov2640: check table mismatch count %s.\n", reg16 == 0 ? "ok" : "error");
+    res = ov2640_set_table_verify(&gs_handle, OV2640_BOOL_FALSE, NULL, 0);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: set table verify failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* ov2640_save_settings/ov2640_restore_settings test */
+    ov2640_interface_debug_print("ov2640: ov2640_save_settings/ov2640_restore_settings test.\n");
+    
+    /* save the settings */
+    res = ov2640_get_horizontal_mirror(&gs_handle, &enable);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: get horizontal mirror failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ov2640_save_settings(&gs_handle, gs_settings, OV2640_SETTINGS_SIZE);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: save settings failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ov2640_interface_debug_print("ov2640: save settings.\n");
+    
+    /* change the settings */
+    res = ov2640_set_horizontal_mirror(&gs_handle, enable == OV2640_BOOL_TRUE ? OV2640_BOOL_FALSE : OV2640_BOOL_TRUE);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: set horizontal mirror failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ov2640_set_contrast(&gs_handle, OV2640_CONTRAST_POSITIVE_2);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: set contrast failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* damaged blob */
+    gs_settings[OV2640_SETTINGS_HEADER_SIZE] ^= 0x01;
+    res = ov2640_restore_settings(&gs_handle, gs_settings, OV2640_SETTINGS_SIZE);
+    gs_settings[OV2640_SETTINGS_HEADER_SIZE] ^= 0x01;
+    ov2640_interface_debug_print("ov2640: check settings crc %s.\n", res == 5 ? "ok" : "error");
+    
+    /* restore the settings */
+    res = ov2640_restore_settings(&gs_handle, gs_settings, OV2640_SETTINGS_SIZE);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: restore settings failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ov2640_interface_debug_print("ov2640: restore settings.\n");
+    res = ov2640_get_horizontal_mirror(&gs_handle, &enable_check);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: get horizontal mirror failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ov2640_interface_debug_print("ov2640: check settings %s.\n", enable == enable_check ? "ok" : "error");
+    
+    /* ov2640_set_trace/ov2640_get_trace/ov2640_trace_mark test */
+    ov2640_interface_debug_print("ov2640: ov2640_set_trace/ov2640_get_trace/ov2640_trace_mark test.\n");
+    
+    /* start the trace */
+    res = ov2640_set_trace(&gs_handle, trace, 8);
+    if (res == 0)
+    {
+        ov2640_interface_debug_print("ov2640: start trace.\n");
+        
+        /* mark a phase */
+        res = ov2640_trace_mark(&gs_handle, 0x5A);
+        if (res != 0)
+        {
+            ov2640_interface_debug_print("ov2640: trace mark failed.\n");
+            (void)ov2640_deinit(&gs_handle);
+        
+            return 1;
+        }
+        res = ov2640_get_trace(&gs_handle, &first, &count, &total);
+        if (res != 0)
+        {
+            ov2640_interface_debug_print("ov2640: get trace failed.\n");
+            (void)ov2640_deinit(&gs_handle);
+        
+            return 1;
+        }
+        ov2640_interface_debug_print("ov2640: check trace mark %s.\n", (count == 1) && (trace[first].flag == OV2640_TRACE_FLAG_MARK) &&
+                                     (trace[first].value == 0x5A) ? "ok" : "error");
+        
+        /* trace a write */
+        res = ov2640_get_dsp_reg(&gs_handle, 0x44, &reg8);
+        if (res != 0)
+        {
+            ov2640_interface_debug_print("ov2640: get dsp reg failed.\n");
+            (void)ov2640_deinit(&gs_handle);
+        
+            return 1;
+        }
+        res = ov2640_set_dsp_reg(&gs_handle, 0x44, reg8 ^ 0x01);
+        if (res != 0)
+        {
+            ov2640_interface_debug_print("ov2640: set dsp reg failed.\n");
+            (void)ov2640_deinit(&gs_handle);
+        
+            return 1;
+        }
+        res = ov2640_get_trace(&gs_handle, &first, &count, &total);
+        if (res != 0)
+        {
+            ov2640_interface_debug_print("ov2640: get trace failed.\n");
+            (void)ov2640_deinit(&gs_handle);
+        
+            return 1;
+        }
+        i = (uint8_t)((first + count - 1) % 8);
+        ov2640_interface_debug_print("ov2640: check trace write %s.\n", (trace[i].bank == OV2640_BANK_DSP) && (trace[i].reg == 0x44) &&
+                                     (trace[i].value == (reg8 ^ 0x01)) && (trace[i].flag == OV2640_TRACE_FLAG_WRITE) ? "ok" : "error");
+        
+        /* wrap the ring */
+        for (j = 0; j < 9; j++)
+        {
+            res = ov2640_set_dsp_reg(&gs_handle, 0x44, reg8 ^ (j & 0x01));
+            if (res != 0)
+            {
+                ov2640_interface_debug_print("ov2640: set dsp reg failed.\n");
+                (void)ov2640_deinit(&gs_handle);
+        
+                return 1;
+            }
+        }
+        res = ov2640_get_trace(&gs_handle, &first, &count, &total);
+        if (res != 0)
+        {
+            ov2640_interface_debug_print("ov2640: get trace failed.\n");
+            (void)ov2640_deinit(&gs_handle);
+        
+            return 1;
+        }
+        ov2640_interface_debug_print("ov2640: check trace wrap %s.\n", (count == 8) && (total > 8) && (first == total % 8) ? "ok" : "error");
+        
+        /* stop the trace */
+        res = ov2640_set_trace(&gs_handle, NULL, 0);
+        if (res != 0)
+        {
+            ov2640_interface_debug_print("ov2640: set trace failed.\n");
+            (void)ov2640_deinit(&gs_handle);
+        
+            return 1;
+        }
+    }
+    else
+    {
+        ov2640_interface_debug_print("ov2640: trace is disabled.\n");
+    }
+    
+    /* ov2640_get_perf_stats/ov2640_clear_perf_stats test */
+    ov2640_interface_debug_print("ov2640: ov2640_get_perf_stats/ov2640_clear_perf_stats test.\n");
+    
+    /* clear the histograms */
+    res = ov2640_clear_perf_stats(&gs_handle);
+    if (res == 0)
+    {
+        ov2640_interface_debug_print("ov2640: clear perf stats.\n");
+        
+        /* time an api */
+        res = ov2640_set_light_mode(&gs_handle, OV2640_LIGHT_MODE_SUNNY);
+        if (res != 0)
+        {
+            ov2640_interface_debug_print("ov2640: set light mode failed.\n");
+            (void)ov2640_deinit(&gs_handle);
+        
+            return 1;
+        }
+        res = ov2640_get_perf_stats(&gs_handle, OV2640_PERF_LIGHT_MODE, &perf);
+        if (res != 0)
+        {
+            ov2640_interface_debug_print("ov2640: get perf stats failed.\n");
+            (void)ov2640_deinit(&gs_handle);
+        
+            return 1;
+        }
+        reg32 = 0;
+        for (j = 0; j < OV2640_PERF_BUCKET_MAX; j++)
+        {
+            reg32 += perf.bucket[j];
+        }
+        ov2640_interface_debug_print("ov2640: light mode %d calls, total %d us, max %d us.\n", perf.count, perf.total_us, perf.max_us);
+        ov2640_interface_debug_print("ov2640: check perf api %s.\n", (perf.count == 1) && (reg32 == 1) && (perf.max_us == perf.total_us) ? "ok" : "error");
+        
+        /* time the bus writes */
+        res = ov2640_get_dsp_reg(&gs_handle, 0x44, &reg8);
+        if (res != 0)
+        {
+            ov2640_interface_debug_print("ov2640: get dsp reg failed.\n");
+            (void)ov2640_deinit(&gs_handle);
+        
+            return 1;
+        }
+        res = ov2640_set_dsp_reg(&gs_handle, 0x44, reg8 ^ 0x01);
+        if (res != 0)
+        {
+            ov2640_interface_debug_print("ov2640: set dsp reg failed.\n");
+            (void)ov2640_deinit(&gs_handle);
+        
+            return 1;
+        }
+        res = ov2640_set_dsp_reg(&gs_handle, 0x44, reg8);
+        if (res != 0)
+        {
+            ov2640_interface_debug_print("ov2640: set dsp reg failed.\n");
+            (void)ov2640_deinit(&gs_handle);
+        
+            return 1;
+        }
+        res = ov2640_get_perf_stats(&gs_handle, OV2640_PERF_SCCB_WRITE, &perf);
+        if (res != 0)
+        {
+            ov2640_interface_debug_print("ov2640: get perf stats failed.\n");
+            (void)ov2640_deinit(&gs_handle);
+        
+            return 1;
+        }
+        ov2640_interface_debug_print("ov2640: sccb write %d calls, total %d us, max %d us.\n", perf.count, perf.total_us, perf.max_us);
+        ov2640_interface_debug_print("ov2640: check perf bus %s.\n", (perf.count >= 2) && (perf.max_us <= perf.total_us) ? "ok" : "error");
+        
+        /* clear the histograms */
+        res = ov2640_clear_perf_stats(&gs_handle);
+        if (res != 0)
+        {
+            ov2640_interface_debug_print("ov2640: clear perf stats failed.\n");
+            (void)ov2640_deinit(&gs_handle);
+        
+            return 1;
+        }
+        res = ov2640_get_perf_stats(&gs_handle, OV2640_PERF_SCCB_WRITE, &perf);
+        if (res != 0)
+        {
+            ov2640_interface_debug_print("ov2640: get perf stats failed.\n");
+            (void)ov2640_deinit(&gs_handle);
+        
+            return 1;
+        }
+        ov2640_interface_debug_print("ov2640: check perf clear %s.\n", (perf.count == 0) && (perf.max_us == 0) ? "ok" : "error");
+    }
+    else
+    {
+        ov2640_interface_debug_print("ov2640: perf is disabled.\n");
+    }
+    
+    /* ov2640_get_bus_stats test */
+    ov2640_interface_debug_print("ov2640: ov2640_get_bus_stats test.\n");
+    
+    /* count the bus writes */
+    res = ov2640_get_dsp_reg(&gs_handle, 0x44, &reg8);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: get dsp reg failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ov2640_get_bus_stats(&gs_handle, &bus_stats);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: get bus stats failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ov2640_set_dsp_reg(&gs_handle, 0x44, reg8 ^ 0x01);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: set dsp reg failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ov2640_set_dsp_reg(&gs_handle, 0x44, reg8);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: set dsp reg failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = ov2640_get_bus_stats(&gs_handle, &bus_stats_check);
+    if (res != 0)
+    {
+        ov2640_interface_debug_print("ov2640: get bus stats failed.\n");
+        (void)ov2640_deinit(&gs_handle);
+        
+        return 1;
+    }
+    ov2640_interface_debug_print("ov2640: %d reads, %d writes, %d bank switches, %d bytes, %d failures, bus %d us.\n",
+                                 bus_stats_check.reads, bus_stats_check.writes, bus_stats_check.bank_switches,
+                                 bus_stats_check.bytes, bus_stats_check.failures, bus_stats_check.time_us);
+    ov2640_interface_debug_print("ov2640: check bus stats %s.\n", (bus_stats_check.writes - bus_stats.writes >= 2) &&
+                                 (bus_stats_check.bytes - bus_stats.bytes >= 2) && (bus_stats_check.failures == bus_stats.failures) &&
+                                 (bus_stats_check.time_us > bus_stats.time_us) ? "ok" : "error");
+    
     /* finish register */
     ov2640_interface_debug_print("ov2640: finish register test.\n");
     (void)ov2640_deinit(&gs_handle);